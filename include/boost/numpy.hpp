@@ -22,10 +22,11 @@
 
 #include <boost/python.hpp>
 
-// For user convenience, include also the ndarray, and matrix class, as well as
-// the iterator templates.
+// For user convenience, include also the ndarray, and matrix class, the record
+// registration macro, as well as the iterator templates.
 #include <boost/numpy/ndarray.hpp>
 #include <boost/numpy/matrix.hpp>
+#include <boost/numpy/record.hpp>
 #include <boost/numpy/iterators/flat_iterator.hpp>
 #include <boost/numpy/iterators/indexed_iterator.hpp>
 #include <boost/numpy/iterators/multi_flat_iterator.hpp>
@@ -26,6 +26,9 @@
 #include <boost/preprocessor/repetition/enum_binary_params.hpp>
 #include <boost/preprocessor/repetition/enum_params.hpp>
 
+#include <boost/mpl/if.hpp>
+#include <boost/type_traits/is_class.hpp>
+
 #include <boost/numpy/limits.hpp>
 #include <boost/numpy/mpl/unspecified.hpp>
 #include <boost/numpy/detail/callable_ptr.hpp>
@@ -36,58 +39,76 @@ namespace detail {
 
 //==============================================================================
 /**
- * \brief The master template is used to handle class member functions. The
- *     specialized template with ClassT = numpy::mpl::unspecified is used for
- *     handling standalone functions.
+ * \brief The master template is used to handle run-time function pointers,
+ *     class member function pointers, and function objects. Function pointers
+ *     are called through a callable_ptr object. A ClassT =
+ *     numpy::mpl::unspecified selects the standalone function version of the
+ *     callable_ptr template. Function objects are called through a
+ *     functor_callable_ptr object, which keeps the type of the function object.
  */
 template <
     int InArity
+  , class F
   , class ClassT
   , typename OutT
   , BOOST_PP_ENUM_BINARY_PARAMS(BOOST_NUMPY_LIMIT_INPUT_ARITY, typename InT_, = numpy::mpl::unspecified BOOST_PP_INTERCEPT)
 >
 struct callable_caller
 {
-    typedef callable_ptr<
-        InArity
-      , ClassT
-      , OutT
-      , BOOST_PP_ENUM_PARAMS(BOOST_NUMPY_LIMIT_INPUT_ARITY, InT_)
-      > callable_ptr_call_t;
+    typedef typename boost::mpl::if_<
+        typename boost::is_class<F>::type
+      , functor_callable_ptr<
+            InArity
+          , F
+          , OutT
+          , BOOST_PP_ENUM_PARAMS(BOOST_NUMPY_LIMIT_INPUT_ARITY, InT_)
+        >
+      , callable_ptr<
+            InArity
+          , ClassT
+          , OutT
+          , BOOST_PP_ENUM_PARAMS(BOOST_NUMPY_LIMIT_INPUT_ARITY, InT_)
+        >
+      >::type callable_ptr_call_t;
 
-    template <class F>
     callable_caller(F f)
-      : call(callable_ptr_call_t(typename callable_ptr_call_t::bfunc_t(f)))
+      : call(f)
     {}
 
     callable_ptr_call_t const call;
 };
 
 //______________________________________________________________________________
-// Template specialization for ClassT = numpy::mpl::unspecified for calling a
-// standalone function.
+// Template specialization for a function or class member function pointer,
+// which is known at compile time. The call does not go through a
+// boost::function object and can be inlined by the compiler.
 template <
     int InArity
+  , class FPtr
+  , FPtr fptr
+  , class ClassT
   , typename OutT
   , BOOST_PP_ENUM_PARAMS(BOOST_NUMPY_LIMIT_INPUT_ARITY, typename InT_)
 >
 struct callable_caller<
     InArity
-  , numpy::mpl::unspecified
+  , static_fctptr<FPtr, fptr>
+  , ClassT
   , OutT
   , BOOST_PP_ENUM_PARAMS(BOOST_NUMPY_LIMIT_INPUT_ARITY, InT_)
 >
 {
-    typedef callable_ptr<
+    typedef static_callable_ptr<
         InArity
-      , numpy::mpl::unspecified
+      , FPtr
+      , fptr
+      , ClassT
       , OutT
       , BOOST_PP_ENUM_PARAMS(BOOST_NUMPY_LIMIT_INPUT_ARITY, InT_)
       > callable_ptr_call_t;
 
-    template <class F>
-    callable_caller(F f)
-      : call(callable_ptr_call_t(typename callable_ptr_call_t::bfunc_t(f)))
+    callable_caller(static_fctptr<FPtr, fptr>)
+      : call()
     {}
 
     callable_ptr_call_t const call;
@@ -10,8 +10,8 @@
  * \date    $Date$
  * \author  Martin Wolf <boostnumpy@martin-wolf.org>
  *
- * \brief This file defines a template for describing a function pointer or a
- *        class member function pointer.
+ * \brief This file defines a template for describing a function pointer, a
+ *        class member function pointer, or a function object.
  *
  *        This file is distributed under the Boost Software License,
  *        Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
@@ -53,6 +53,48 @@ template <
 >
 struct callable_ptr;
 
+/**
+ * \brief The static_fctptr class template is a tag type carrying a function
+ *     pointer or a class member function pointer as non-type template
+ *     argument. Contrary to a run-time function pointer, the called function
+ *     is known at compile time and can be inlined into the calling loop.
+ */
+template <class F, F f>
+struct static_fctptr
+{
+    typedef F fctptr_t;
+};
+
+/**
+ * \brief The static_callable_ptr class template is the compile-time
+ *     counterpart of the callable_ptr class template. It calls the function
+ *     given by the non-type template argument f directly.
+ */
+template <
+    int InArity
+  , class F
+  , F f
+  , class ClassT
+  , typename OutT
+  , BOOST_PP_ENUM_BINARY_PARAMS(BOOST_NUMPY_LIMIT_INPUT_ARITY, typename InT_, = numpy::mpl::unspecified BOOST_PP_INTERCEPT)
+>
+struct static_callable_ptr;
+
+/**
+ * \brief The functor_callable_ptr class template calls a function object,
+ *     e.g. a lambda function. The function object is stored by value, so the
+ *     compiler knows its type and can inline its call operator. Each copy of a
+ *     functor_callable_ptr object holds its own copy of the function object
+ *     state.
+ */
+template <
+    int InArity
+  , class F
+  , typename OutT
+  , BOOST_PP_ENUM_BINARY_PARAMS(BOOST_NUMPY_LIMIT_INPUT_ARITY, typename InT_, = numpy::mpl::unspecified BOOST_PP_INTERCEPT)
+>
+struct functor_callable_ptr;
+
 //______________________________________________________________________________
 // Partial specialization for in_arity = N.
 #define BOOST_PP_ITERATION_PARAMS_1                                            \
@@ -127,6 +169,87 @@ struct callable_ptr<
     }
 };
 
+//______________________________________________________________________________
+// Specialization for input arity IN_ARITY of a static class member function
+// pointer.
+template <
+    class F
+  , F f
+  , class ClassT
+  , typename OutT
+  , BOOST_PP_ENUM_PARAMS(BOOST_NUMPY_LIMIT_INPUT_ARITY, typename InT_)
+>
+struct static_callable_ptr<
+    IN_ARITY
+  , F
+  , f
+  , ClassT
+  , OutT
+  , BOOST_PP_ENUM_PARAMS(BOOST_NUMPY_LIMIT_INPUT_ARITY, InT_)
+>
+{
+    inline
+    OutT
+    operator()(ClassT & self, BOOST_PP_ENUM_BINARY_PARAMS(IN_ARITY, InT_, in_)) const
+    {
+        return (self.*f)(BOOST_PP_ENUM_PARAMS(IN_ARITY, in_));
+    }
+};
+
+//______________________________________________________________________________
+// Specialization for input arity IN_ARITY of a static function pointer.
+template <
+    class F
+  , F f
+  , typename OutT
+  , BOOST_PP_ENUM_PARAMS(BOOST_NUMPY_LIMIT_INPUT_ARITY, typename InT_)
+>
+struct static_callable_ptr<
+    IN_ARITY
+  , F
+  , f
+  , numpy::mpl::unspecified
+  , OutT
+  , BOOST_PP_ENUM_PARAMS(BOOST_NUMPY_LIMIT_INPUT_ARITY, InT_)
+>
+{
+    inline
+    OutT
+    operator()(numpy::mpl::unspecified &, BOOST_PP_ENUM_BINARY_PARAMS(IN_ARITY, InT_, in_)) const
+    {
+        return f(BOOST_PP_ENUM_PARAMS(IN_ARITY, in_));
+    }
+};
+
+//______________________________________________________________________________
+// Specialization for input arity IN_ARITY of a function object.
+template <
+    class F
+  , typename OutT
+  , BOOST_PP_ENUM_PARAMS(BOOST_NUMPY_LIMIT_INPUT_ARITY, typename InT_)
+>
+struct functor_callable_ptr<
+    IN_ARITY
+  , F
+  , OutT
+  , BOOST_PP_ENUM_PARAMS(BOOST_NUMPY_LIMIT_INPUT_ARITY, InT_)
+>
+{
+    // The function object is mutable, because its call operator might not be
+    // declared const.
+    mutable F f_;
+    functor_callable_ptr(F const & f)
+      : f_(f)
+    {}
+
+    inline
+    OutT
+    operator()(numpy::mpl::unspecified &, BOOST_PP_ENUM_BINARY_PARAMS(IN_ARITY, InT_, in_)) const
+    {
+        return f_(BOOST_PP_ENUM_PARAMS(IN_ARITY, in_));
+    }
+};
+
 #undef IN_ARITY
 
 #endif // !BOOST_PP_IS_ITERATING
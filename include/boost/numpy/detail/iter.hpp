@@ -31,6 +31,7 @@
 #include <limits>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <boost/python.hpp>
 
@@ -45,6 +46,7 @@
 #include <boost/numpy/limits.hpp>
 #include <boost/numpy/numpy_c_api.hpp>
 #include <boost/numpy/detail/logging.hpp>
+#include <boost/numpy/dtype.hpp>
 #include <boost/numpy/ndarray.hpp>
 #include <boost/numpy/types.hpp>
 
@@ -95,11 +97,25 @@ struct iter_operand
     ndarray const &      ndarray_;
     iter_operand_flags_t flags_;
     int *                broadcasting_rules_;
+    dtype                dtype_;
 
     iter_operand(ndarray const & arr, iter_operand_flags_t f, int * bcr)
       : ndarray_(arr),
         flags_(f),
-        broadcasting_rules_(bcr)
+        broadcasting_rules_(bcr),
+        dtype_(arr.get_dtype())
+    {}
+
+    /**
+     * \brief Constructs an iterator operand, whose data is presented to the
+     *     iteration with the data type \a dt. If it differs from the data type
+     *     of the array, the BUFFERED iterator casts the data into its buffers.
+     */
+    iter_operand(ndarray const & arr, iter_operand_flags_t f, int * bcr, dtype const & dt)
+      : ndarray_(arr),
+        flags_(f),
+        broadcasting_rules_(bcr),
+        dtype_(dt)
     {}
 };
 
@@ -137,6 +153,25 @@ class iter
         (4, (1, BOOST_NUMPY_LIMIT_INPUT_AND_OUTPUT_ARITY, <boost/numpy/detail/iter.hpp>, 1))
     #include BOOST_PP_ITERATE()
 
+    //__________________________________________________________________________
+    /**
+     * \brief Constructs a multi operand iterator for a number of operands,
+     *     which is known only at run-time.
+     *
+     * \param n_iter_axes The number of axes that will be iterated.
+     * \param ops The pointers to the iterator operands. The vector must not
+     *     be empty.
+     */
+    iter(
+          iter_flags_t iter_flags
+        , order_t      order
+        , casting_t    casting
+        , int          n_iter_axes
+        , intptr_t *   itershape
+        , intptr_t     buffersize
+        , std::vector<iter_operand const *> const & ops
+    );
+
     //__________________________________________________________________________
     /**
      * \brief The destructor deallocates the internal numpy iterator object.
@@ -522,7 +557,7 @@ iter(
     BOOST_PP_COMMA_IF(n) BOOST_PP_CAT(op_,n).flags_
 
 #define BOOST_NUMPY_DETAIL_ITER__op_dtype_ptr(z, n, data)                      \
-    BOOST_PP_COMMA_IF(n) reinterpret_cast<PyArray_Descr*>(BOOST_PP_CAT(op_,n).ndarray_.get_dtype().ptr())
+    BOOST_PP_COMMA_IF(n) reinterpret_cast<PyArray_Descr*>(BOOST_PP_CAT(op_,n).dtype_.ptr())
 
 #define BOOST_NUMPY_DETAIL_ITER__op_bcr(z, n, data)                            \
     BOOST_PP_COMMA_IF(n) BOOST_PP_CAT(op_,n).broadcasting_rules_
@@ -20,7 +20,12 @@
 #ifndef BOOST_NUMPY_DSTREAM_HPP_INCLUDED
 #define BOOST_NUMPY_DSTREAM_HPP_INCLUDED
 
+#include <boost/numpy/dstream/array_view.hpp>
+#include <boost/numpy/dstream/copy_monitor.hpp>
+#include <boost/numpy/dstream/packed_bool.hpp>
 #include <boost/numpy/dstream/mapping.hpp>
 #include <boost/numpy/dstream/def.hpp>
+#include <boost/numpy/dstream/dequantize.hpp>
+#include <boost/numpy/dstream/columns.hpp>
 
 #endif // !BOOST_NUMPY_DSTREAM_HPP_INCLUDED
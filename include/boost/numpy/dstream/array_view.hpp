@@ -0,0 +1,218 @@
+/**
+ * $Id$
+ *
+ * Copyright (C)
+ * 2014 - $Date$
+ *     Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \file    boost/numpy/dstream/array_view.hpp
+ * \version $Revision$
+ * \date    $Date$
+ * \author  Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \brief This file defines the boost::numpy::dstream::array_view<T, nd>
+ *        template. It is a lightweight non-owning strided view of the core
+ *        dimensions of an ndarray operand. It can be used as function argument
+ *        type instead of a (nested) std::vector, in which case the function
+ *        accesses the array data directly without any copying.
+ *
+ *        This file is distributed under the Boost Software License,
+ *        Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ *        http://www.boost.org/LICENSE_1_0.txt).
+ */
+#ifndef BOOST_NUMPY_DSTREAM_ARRAY_VIEW_HPP_INCLUDED
+#define BOOST_NUMPY_DSTREAM_ARRAY_VIEW_HPP_INCLUDED
+
+#include <stdint.h>
+
+#include <cstddef>
+
+#include <boost/preprocessor/arithmetic/inc.hpp>
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/repetition/enum_params.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <boost/preprocessor/repetition/repeat_from_to.hpp>
+
+#include <boost/mpl/assert.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/static_assert.hpp>
+
+#include <boost/numpy/limits.hpp>
+
+namespace boost {
+namespace numpy {
+namespace dstream {
+
+template <class T, unsigned nd>
+class array_view;
+
+namespace detail {
+
+template <class T, unsigned nd>
+struct array_view_subscript
+{
+    typedef array_view<T, nd-1>
+            type;
+
+    static
+    type
+    apply(char * data, intptr_t const * shape, intptr_t const * strides)
+    {
+        return type(data, shape+1, strides+1);
+    }
+};
+
+template <class T>
+struct array_view_subscript<T, 1>
+{
+    typedef T &
+            type;
+
+    static
+    type
+    apply(char * data, intptr_t const *, intptr_t const *)
+    {
+        return *reinterpret_cast<T *>(data);
+    }
+};
+
+}// namespace detail
+
+/**
+ * The array_view<T, nd> template describes nd core dimensions of an array
+ * operand through a data pointer, a shape, and the strides (in bytes) of each
+ * dimension. It does not own the data and it is cheap to copy.
+ * A const value type T makes the view read-only.
+ */
+template <class T, unsigned nd>
+class array_view
+{
+  public:
+    BOOST_STATIC_ASSERT_MSG((nd >= 1 && nd <= BOOST_NUMPY_LIMIT_CORE_SHAPE_ND),
+        "The dimensionality of an array_view must be within [1, BOOST_NUMPY_LIMIT_CORE_SHAPE_ND].");
+
+    typedef T
+            value_type;
+    typedef T &
+            reference;
+    typedef typename detail::array_view_subscript<T, nd>::type
+            subscript_t;
+
+    BOOST_STATIC_CONSTANT(unsigned, ndim = nd);
+
+    array_view()
+      : data_(NULL)
+    {
+        for(unsigned i=0; i<nd; ++i)
+        {
+            shape_[i]   = 0;
+            strides_[i] = 0;
+        }
+    }
+
+    array_view(char * data, intptr_t const * shape, intptr_t const * strides)
+      : data_(data)
+    {
+        for(unsigned i=0; i<nd; ++i)
+        {
+            shape_[i]   = shape[i];
+            strides_[i] = strides[i];
+        }
+    }
+
+    /**
+     * \brief Returns the number of elements of the given dimension.
+     */
+    inline
+    intptr_t
+    size(unsigned dim) const
+    {
+        return shape_[dim];
+    }
+
+    /**
+     * \brief Returns the stride in bytes of the given dimension.
+     */
+    inline
+    intptr_t
+    stride(unsigned dim) const
+    {
+        return strides_[dim];
+    }
+
+    /**
+     * \brief Returns the pointer to the first element of the view.
+     */
+    inline
+    char *
+    data() const
+    {
+        return data_;
+    }
+
+    /**
+     * \brief Sets the pointer to the first element of the view. The shape and
+     *     the strides of the view stay unchanged.
+     */
+    inline
+    void
+    set_data(char * data)
+    {
+        data_ = data;
+    }
+
+    /**
+     * \brief Returns the i-th element of the first dimension. For a
+     *     one-dimensional view this is a reference to the element, otherwise
+     *     it is a view of dimensionality nd-1.
+     */
+    inline
+    subscript_t
+    operator[](intptr_t i) const
+    {
+        return detail::array_view_subscript<T, nd>::apply(data_ + i*strides_[0], shape_, strides_);
+    }
+
+    // Define the element access operator for all possible dimensionalities.
+    // Only the one with nd arguments is valid.
+    #define BOOST_NUMPY_DSTREAM_offset(z, n, data) \
+        + BOOST_PP_CAT(i,n)*strides_[n]
+    #define BOOST_NUMPY_DSTREAM_DEF(z, n, data)                                \
+        inline                                                                 \
+        reference                                                              \
+        operator()(BOOST_PP_ENUM_PARAMS_Z(z, n, intptr_t i)) const             \
+        {                                                                      \
+            BOOST_MPL_ASSERT_MSG((n == nd),                                    \
+                THE_NUMBER_OF_INDICES_MUST_MATCH_THE_DIMENSIONALITY_OF_THE_ARRAY_VIEW, ()); \
+            return *reinterpret_cast<T *>(data_ BOOST_PP_REPEAT_ ## z(n, BOOST_NUMPY_DSTREAM_offset, ~)); \
+        }
+    BOOST_PP_REPEAT_FROM_TO(1, BOOST_PP_INC(BOOST_NUMPY_LIMIT_CORE_SHAPE_ND), BOOST_NUMPY_DSTREAM_DEF, ~)
+    #undef BOOST_NUMPY_DSTREAM_DEF
+    #undef BOOST_NUMPY_DSTREAM_offset
+
+  protected:
+    char *   data_;
+    intptr_t shape_[nd];
+    intptr_t strides_[nd];
+};
+
+template <class T>
+struct is_array_view
+  : boost::mpl::false_
+{};
+
+template <class T, unsigned nd>
+struct is_array_view< array_view<T, nd> >
+  : boost::mpl::true_
+{};
+
+template <class T, unsigned nd>
+struct is_array_view< array_view<T, nd> const >
+  : boost::mpl::true_
+{};
+
+}// namespace dstream
+}// namespace numpy
+}// namespace boost
+
+#endif // !BOOST_NUMPY_DSTREAM_ARRAY_VIEW_HPP_INCLUDED
@@ -0,0 +1,125 @@
+/**
+ * $Id$
+ *
+ * Copyright (C)
+ * 2014 - $Date$
+ *     Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * @file    boost/numpy/dstream/columns.hpp
+ * @version $Revision$
+ * @date    $Date$
+ * @author  Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * @brief This file defines the boost::numpy::dstream::columns function,
+ *        which adapts a function with k scalar arguments to take the k
+ *        columns of a single (N, k) input array instead. The columns are read
+ *        from the one iterator operand with fixed offsets, so no strided
+ *        column views and no additional iterator operands are needed.
+ *
+ *        This file is distributed under the Boost Software License,
+ *        Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ *        http://www.boost.org/LICENSE_1_0.txt).
+ */
+#if !defined(BOOST_PP_IS_ITERATING)
+
+#ifndef BOOST_NUMPY_DSTREAM_COLUMNS_HPP_INCLUDED
+#define BOOST_NUMPY_DSTREAM_COLUMNS_HPP_INCLUDED
+
+#include <boost/array.hpp>
+
+#include <boost/preprocessor/iterate.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
+#include <boost/preprocessor/repetition/enum_params.hpp>
+
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+#include <boost/numpy/limits.hpp>
+#include <boost/numpy/dstream/def.hpp>
+
+namespace boost {
+namespace numpy {
+namespace dstream {
+namespace detail {
+
+/**
+ * The columns_as_args template is a function object calling the function
+ * FPtr with N arguments. It takes the N values as one fixed-size array of the
+ * type of the first argument, i.e. as a fixed core dimension of length N, and
+ * passes its elements as the individual arguments.
+ */
+template <class FPtr>
+struct columns_as_args;
+
+#define BOOST_PP_ITERATION_PARAMS_1                                            \
+    (3, (1, BOOST_NUMPY_LIMIT_INPUT_ARITY, <boost/numpy/dstream/columns.hpp>))
+#include BOOST_PP_ITERATE()
+
+}// namespace detail
+
+/**
+ * The columns function adapts the function f(x, y, z) with k scalar arguments
+ * to take one input array, whose last dimension of length k holds the values
+ * of the k arguments, e.g.
+ *
+ *     dstream::def("f", dstream::columns(&f), bp::arg("t"));
+ *
+ * So f(t) evaluates f(t[...,0], t[...,1], t[...,2]) for an (N, 3) array t.
+ * The values are of the type of the first argument of f. A record array,
+ * whose k fields have this type and a constant byte distance, can be passed
+ * as well. Its fields are bound to the arguments in their order.
+ */
+template <class FPtr>
+detail::functor_with_signature<
+      detail::columns_as_args<FPtr>
+    , typename detail::columns_as_args<FPtr>::signature_t
+>
+columns(FPtr f)
+{
+    return detail::functor_with_signature<
+                 detail::columns_as_args<FPtr>
+               , typename detail::columns_as_args<FPtr>::signature_t
+           >(detail::columns_as_args<FPtr>(f));
+}
+
+}// namespace dstream
+}// namespace numpy
+}// namespace boost
+
+#endif // !BOOST_NUMPY_DSTREAM_COLUMNS_HPP_INCLUDED
+#else
+
+#define N BOOST_PP_ITERATION()
+
+template <class R, BOOST_PP_ENUM_PARAMS(N, class A)>
+struct columns_as_args<R (*)(BOOST_PP_ENUM_PARAMS(N, A))>
+{
+    typedef R (*fptr_t)(BOOST_PP_ENUM_PARAMS(N, A));
+
+    typedef typename remove_cv<typename remove_reference<A0>::type>::type
+            value_t;
+
+    typedef boost::array<value_t, N>
+            columns_t;
+
+    typedef R signature_t(columns_t const &);
+
+    columns_as_args(fptr_t f)
+      : f_(f)
+    {}
+
+    #define BOOST_NUMPY_DSTREAM_DEF(z, n, data) c[n]
+    inline
+    R
+    operator()(columns_t const & c) const
+    {
+        return f_(BOOST_PP_ENUM(N, BOOST_NUMPY_DSTREAM_DEF, ~));
+    }
+    #undef BOOST_NUMPY_DSTREAM_DEF
+
+    fptr_t f_;
+};
+
+#undef N
+
+#endif // BOOST_PP_IS_ITERATING
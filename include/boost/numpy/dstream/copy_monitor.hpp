@@ -0,0 +1,112 @@
+/**
+ * $Id$
+ *
+ * Copyright (C)
+ * 2014 - $Date$
+ *     Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \file    boost/numpy/dstream/copy_monitor.hpp
+ * \version $Revision$
+ * \date    $Date$
+ * \author  Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \brief This file defines the boost::numpy::dstream::copy_monitor class,
+ *        which counts the implicit copies of input arrays made by generalized
+ *        universal functions, e.g. because of a data type mismatch. Depending
+ *        on the copy mode, a copy issues a Python warning or raises an
+ *        exception instead.
+ *
+ *        This file is distributed under the Boost Software License,
+ *        Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ *        http://www.boost.org/LICENSE_1_0.txt).
+ */
+#ifndef BOOST_NUMPY_DSTREAM_COPY_MONITOR_HPP_INCLUDED
+#define BOOST_NUMPY_DSTREAM_COPY_MONITOR_HPP_INCLUDED
+
+#include <stdint.h>
+
+namespace boost {
+namespace numpy {
+namespace dstream {
+
+typedef enum {
+    COPY_ALLOWED = 0, // Copies are made and counted.
+    COPY_WARN    = 1, // Copies are made, counted, and a RuntimeWarning is issued.
+    COPY_NEVER   = 2  // Copies raise a RuntimeError.
+} copy_mode_t;
+
+/**
+ * The copy_monitor class holds the process-wide copy mode and the copy
+ * counters. It is updated while the Python GIL is held, i.e. before the
+ * iteration threads are started.
+ */
+class copy_monitor
+{
+  public:
+    static
+    void
+    set_mode(copy_mode_t mode);
+
+    static
+    copy_mode_t
+    get_mode();
+
+    /**
+     * \brief Returns the number of copies since the last reset.
+     */
+    static
+    intptr_t
+    get_n_copies();
+
+    /**
+     * \brief Returns the total number of copied bytes since the last reset.
+     */
+    static
+    intptr_t
+    get_n_bytes();
+
+    /**
+     * \brief Resets the copy counters. The copy mode stays unchanged.
+     */
+    static
+    void
+    reset();
+
+    /**
+     * \brief Records that the input array with index \a in_arr_idx needs to
+     *     be copied for the given reason. It is called before the copy is
+     *     made. With the COPY_NEVER mode it raises a Python RuntimeError.
+     */
+    static
+    void
+    record(unsigned in_arr_idx, char const * reason, intptr_t nbytes);
+};
+
+/**
+ * The copy_mode_scope class sets the copy mode for its lifetime, e.g. for a
+ * single call of a generalized universal function from C++.
+ */
+class copy_mode_scope
+{
+  public:
+    explicit
+    copy_mode_scope(copy_mode_t mode)
+      : prev_mode_(copy_monitor::get_mode())
+    {
+        copy_monitor::set_mode(mode);
+    }
+
+    ~copy_mode_scope()
+    {
+        copy_monitor::set_mode(prev_mode_);
+    }
+
+  protected:
+    copy_mode_t const prev_mode_;
+};
+
+}// namespace dstream
+}// namespace numpy
+}// namespace boost
+
+#endif // !BOOST_NUMPY_DSTREAM_COPY_MONITOR_HPP_INCLUDED
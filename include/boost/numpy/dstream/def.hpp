@@ -26,17 +26,27 @@
 
 #include <boost/preprocessor/cat.hpp>
 #include <boost/preprocessor/iterate.hpp>
+#include <boost/preprocessor/arithmetic/inc.hpp>
 #include <boost/preprocessor/arithmetic/sub.hpp>
 #include <boost/preprocessor/iteration/local.hpp>
 #include <boost/preprocessor/facilities/intercept.hpp>
+#include <boost/preprocessor/repetition/enum_binary_params.hpp>
 #include <boost/preprocessor/repetition/enum_params.hpp>
 #include <boost/preprocessor/repetition/enum_trailing_params.hpp>
 #include <boost/preprocessor/repetition/enum_trailing_binary_params.hpp>
 #include <boost/preprocessor/repetition/repeat.hpp>
+#include <boost/preprocessor/repetition/repeat_from_to.hpp>
 
+#include <boost/mpl/assert.hpp>
 #include <boost/mpl/at.hpp>
+#include <boost/mpl/begin_end.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/erase.hpp>
+#include <boost/mpl/eval_if.hpp>
 #include <boost/mpl/if.hpp>
+#include <boost/mpl/next.hpp>
 #include <boost/mpl/size.hpp>
+#include <boost/type_traits/is_class.hpp>
 #include <boost/type_traits/is_member_function_pointer.hpp>
 #include <boost/type_traits/is_same.hpp>
 #include <boost/type_traits/remove_reference.hpp>
@@ -45,18 +55,22 @@
 #include <boost/python/signature.hpp>
 #include <boost/python/object/add_to_namespace.hpp>
 #include <boost/python/object/py_function.hpp>
+#include <boost/python/raw_function.hpp>
 #include <boost/python/object/function_object.hpp>
 #include <boost/python/refcount.hpp>
 
 #include <boost/numpy/limits.hpp>
 #include <boost/numpy/mpl/types_from_fctptr_signature.hpp>
 #include <boost/numpy/mpl/unspecified.hpp>
+#include <boost/numpy/detail/callable_ptr.hpp>
 #include <boost/numpy/dstream/threading.hpp>
 #include <boost/numpy/dstream/detail/callable.hpp>
 #include <boost/numpy/dstream/detail/caller.hpp>
 #include <boost/numpy/dstream/detail/def_helper.hpp>
+#include <boost/numpy/dstream/detail/overload_dispatcher.hpp>
 #include <boost/numpy/dstream/mapping.hpp>
 #include <boost/numpy/dstream/mapping/converter/arg_type_to_core_shape.hpp>
+#include <boost/numpy/dstream/mapping/converter/out_arg_types_to_out_mapping.hpp>
 #include <boost/numpy/dstream/mapping/converter/return_type_to_out_mapping.hpp>
 #include <boost/numpy/dstream/wiring.hpp>
 #include <boost/numpy/dstream/wiring/generalized_wiring_model.hpp>
@@ -73,6 +87,9 @@ namespace detail {
  *  to construct the appropriate mapping definition based on the to-be-exposed
  *  function's output and input types. It uses the mapping converters for
  *  converting the output and input types to output and input mapping types.
+ *  The output types are either given by the return type, or by the trailing
+ *  output arguments of a function returning void. InArity is the number of
+ *  the remaining (input) arguments.
  */
 template <unsigned InArity, class FTypes>
 struct default_mapping_definition_selector;
@@ -107,7 +124,7 @@ void create_and_add_py_function(
     // to-be-exposed function.
     typedef typename boost::mpl::eval_if<
               typename boost::is_same<MappingDefinition, mapping::detail::null_definition>::type
-            , default_mapping_definition_selector<FTypes::arity, FTypes>
+            , default_mapping_definition_selector<FTypes::arity - mapping::converter::detail::fct_out_arity<FTypes>::value, FTypes>
             , MappingDefinition
             >::type
             mapping_definition_t;
@@ -162,6 +179,41 @@ void create_and_add_py_function(
     python::objects::add_to_namespace(scope, name, pyfunct_obj, doc);
 }
 
+//==============================================================================
+/** The functor_with_signature template holds a function object together with
+ *  the function type of its call operator, e.g. double (double, double).
+ *  It is created by the dstream::functor function.
+ */
+template <class F, class Signature>
+struct functor_with_signature
+{
+    functor_with_signature(F const & f)
+      : m_f(f)
+    {}
+
+    F m_f;
+};
+
+#if !defined(BOOST_NO_CXX11_DECLTYPE)
+/** The functor_signature template determines the signature of a function
+ *  object from the type of its call operator. This works only for function
+ *  objects with exactly one non-template call operator, e.g. non-generic
+ *  lambda functions.
+ */
+template <class F>
+struct functor_signature
+{
+    typedef decltype(python::detail::get_signature(&F::operator()))
+            mfp_signature_t;
+
+    typedef typename boost::mpl::erase<
+              mfp_signature_t
+            , typename boost::mpl::next<typename boost::mpl::begin<mfp_signature_t>::type>::type
+            >::type
+            type;
+};
+#endif
+
 //==============================================================================
 #define BOOST_PP_ITERATION_PARAMS_1                                            \
     (4, (0, BOOST_NUMPY_DSTREAM_DEF_MAX_OPTIONAL_ARGS, <boost/numpy/dstream/def.hpp>, 2))
@@ -169,9 +221,58 @@ void create_and_add_py_function(
 
 }// namespace detail
 
+/** The functor function wraps a function object together with an explicit
+ *  signature, given as function type, e.g.
+ *  functor<double (double, double)>(f). This is needed for function
+ *  objects whose signature cannot be deduced automatically, e.g. function
+ *  objects with several or templated call operators.
+ */
+template <class Signature, class F>
+detail::functor_with_signature<F, Signature>
+functor(F const & f)
+{
+    return detail::functor_with_signature<F, Signature>(f);
+}
+
+/** The overloads function bundles several C++ functions, e.g. the
+ *  instantiations of a function template for different data types, into one
+ *  generalized universal function:
+ *
+ *      def("f", overloads(&f<float>, &f<double>, &f<int32_t>), (bp::arg("x"), "y"));
+ *
+ *  On each call, the overload is selected whose input array data types match
+ *  the data types of the passed arrays best. All overloads must have the same
+ *  input argument names.
+ */
+#define BOOST_NUMPY_DSTREAM_open(z, n, data) \
+    detail::overload_set< BOOST_PP_CAT(F,n),
+#define BOOST_NUMPY_DSTREAM_make(z, n, data) \
+    detail::make_overload_set( BOOST_PP_CAT(f,n),
+#define BOOST_NUMPY_DSTREAM_close(z, n, data) \
+    >
+#define BOOST_NUMPY_DSTREAM_close_paren(z, n, data) \
+    )
+#define BOOST_NUMPY_DSTREAM_DEF(z, n, data)                                    \
+    template <BOOST_PP_ENUM_PARAMS_Z(z, n, class F)>                           \
+    BOOST_PP_REPEAT_ ## z(n, BOOST_NUMPY_DSTREAM_open, ~)                      \
+        detail::overload_set_end                                               \
+    BOOST_PP_REPEAT_ ## z(n, BOOST_NUMPY_DSTREAM_close, ~)                     \
+    overloads(BOOST_PP_ENUM_BINARY_PARAMS_Z(z, n, F, f))                       \
+    {                                                                          \
+        return BOOST_PP_REPEAT_ ## z(n, BOOST_NUMPY_DSTREAM_make, ~)           \
+                   detail::overload_set_end()                                  \
+               BOOST_PP_REPEAT_ ## z(n, BOOST_NUMPY_DSTREAM_close_paren, ~);   \
+    }
+BOOST_PP_REPEAT_FROM_TO(2, BOOST_PP_INC(BOOST_NUMPY_LIMIT_OVERLOADS), BOOST_NUMPY_DSTREAM_DEF, ~)
+#undef BOOST_NUMPY_DSTREAM_DEF
+#undef BOOST_NUMPY_DSTREAM_close_paren
+#undef BOOST_NUMPY_DSTREAM_close
+#undef BOOST_NUMPY_DSTREAM_make
+#undef BOOST_NUMPY_DSTREAM_open
+
 // The def(...) function needs at least 3 arguments:
 //   - the name of the python function,
-//   - the pointer to the to-be-exposed C++ function, and
+//   - the pointer to the to-be-exposed C++ function or a function object, and
 //   - the names of the keyword arguments.
 // Optionally, a
 //   - boost::python::scope
@@ -238,8 +339,16 @@ template <class FTypes>
 struct default_mapping_definition_selector<IN_ARITY, FTypes>
 {
     // Construct a boost::numpy::dstream::mapping::detail::out type based on
-    // the FTypes::return_type type.
-    typedef typename mapping::converter::detail::return_type_to_out_mapping<typename FTypes::return_type>::type
+    // the output arguments, if there are any, or on the FTypes::return_type
+    // type.
+    typedef mapping::converter::detail::fct_out_arity<FTypes>
+            fct_out_arity_t;
+
+    typedef typename boost::mpl::eval_if_c<
+              (fct_out_arity_t::value > 0)
+            , mapping::converter::detail::out_arg_types_to_out_mapping<FTypes, fct_out_arity_t::value>
+            , mapping::converter::detail::return_type_to_out_mapping<typename FTypes::return_type>
+            >::type
             out_mapping_t;
 
     #define BOOST_NUMPY_DEF(z, n, data) \
@@ -320,6 +429,75 @@ void def_with_signature(
     def_with_ftypes(sc, name, f, (f_types_t*)NULL, kwargs BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
 }
 
+template <
+      class FPtr
+    , FPtr fptr
+    , class KW
+    , class Signature
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class A)
+>
+void def_with_signature(
+      python::scope const& sc
+    , char const* name
+    , numpy::detail::static_fctptr<FPtr, fptr> f
+    , KW const& kwargs
+    , Signature const &
+    BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, A, const & a)
+)
+{
+    typedef typename numpy::mpl::types_from_fctptr_signature<FPtr, Signature>::type
+            f_types_t;
+
+    def_with_ftypes(sc, name, f, (f_types_t*)NULL, kwargs BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
+}
+
+template <
+      class F
+    , class KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class A)
+>
+void def_with_deduced_signature(
+      python::scope const& sc
+    , char const* name
+    , F f
+    , KW const& kwargs
+    , boost::mpl::false_ /*is_functor*/
+    BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, A, const & a)
+)
+{
+    def_with_signature(sc, name, f, kwargs, python::detail::get_signature(f) BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
+}
+
+template <
+      class F
+    , class KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class A)
+>
+void def_with_deduced_signature(
+      python::scope const& sc
+    , char const* name
+    , F f
+    , KW const& kwargs
+    , boost::mpl::true_ /*is_functor*/
+    BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, A, const & a)
+)
+{
+#if !defined(BOOST_NO_CXX11_DECLTYPE)
+    // Deduce the signature from the (unique) call operator of the function
+    // object and remove the class argument from it.
+    typedef typename functor_signature<F>::type
+            signature_t;
+
+    def_with_signature(sc, name, f, kwargs, signature_t() BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
+#else
+    BOOST_MPL_ASSERT_MSG(
+          false
+        , THE_SIGNATURE_OF_A_FUNCTION_OBJECT_MUST_BE_SPECIFIED_EXPLICITLY_USING_DSTREAM_FUNCTOR
+        , (F)
+    );
+#endif
+}
+
 #else
 #if BOOST_PP_ITERATION_FLAGS() == 3
 
@@ -337,7 +515,103 @@ def(
     BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, A, const & a)
 )
 {
-    detail::def_with_signature(sc, name, f, kwargs, python::detail::get_signature(f) BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
+    detail::def_with_deduced_signature(sc, name, f, kwargs, typename boost::is_class<F>::type() BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
+}
+
+template <
+      class F
+    , class Signature
+    , class KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class A)
+>
+void
+def(
+      python::scope const& sc
+    , char const * name
+    , detail::functor_with_signature<F, Signature> const & f
+    , KW const & kwargs
+    BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, A, const & a)
+)
+{
+    detail::def_with_signature(sc, name, f.m_f, kwargs, python::detail::get_signature((Signature*)NULL) BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
+}
+
+namespace detail {
+
+template <
+      class KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class A)
+>
+void
+def_overloads(
+      overload_dispatcher &
+    , python::object const &
+    , char const *
+    , overload_set_end const &
+    , KW const &
+    BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, A, const & BOOST_PP_INTERCEPT)
+)
+{}
+
+template <
+      class F
+    , class Next
+    , class KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class A)
+>
+void
+def_overloads(
+      overload_dispatcher & dispatcher
+    , python::object const & ns
+    , char const * name
+    , overload_set<F, Next> const & fs
+    , KW const & kwargs
+    BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, A, const & a)
+)
+{
+    // Expose the overload as an ordinary generalized universal function and
+    // take it out of the namespace again, so the next overload does not get
+    // chained to it by boost::python.
+    dstream::def(python::scope(ns), name, fs.m_f, kwargs BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
+    dispatcher.add(ns.attr(name), get_in_arr_dtypes(fs.m_f, python::detail::get_signature(fs.m_f)));
+    python::delattr(ns, name);
+
+    def_overloads(dispatcher, ns, name, fs.m_next, kwargs BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
+}
+
+}// namespace detail
+
+template <
+      class F
+    , class Next
+    , class KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class A)
+>
+void
+def(
+      python::scope const& sc
+    , char const * name
+    , detail::overload_set<F, Next> const & fs
+    , KW const & kwargs
+    BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, A, const & a)
+)
+{
+    typedef dstream::detail::def_helper<
+              mapping::detail::null_definition
+            , wiring::detail::null_wiring_model_selector
+            , threading::detail::null_thread_ability_selector
+            BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, A)
+            >
+            def_helper_t;
+    def_helper_t const helper = def_helper_t(BOOST_PP_ENUM_PARAMS_Z(1, N, a));
+
+    // The overloads live in a private module object, from which the
+    // dispatcher holds the Python function objects.
+    python::object const ns(python::handle<>(PyModule_New(name)));
+    detail::overload_dispatcher dispatcher(kwargs.range());
+    detail::def_overloads(dispatcher, ns, name, fs, kwargs BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
+
+    python::objects::add_to_namespace(sc, name, python::raw_function(dispatcher), helper.get_doc());
 }
 
 template <
@@ -359,6 +633,97 @@ def(
     def(sc, name, f, kwargs BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
 }
 
+template <
+      class FPtr
+    , FPtr fptr
+    , class KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class A)
+>
+void
+def(
+      python::scope const& sc
+    , char const * name
+    , numpy::detail::static_fctptr<FPtr, fptr> f
+    , KW const & kwargs
+    BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, A, const & a)
+)
+{
+    detail::def_with_signature(sc, name, f, kwargs, python::detail::get_signature(fptr) BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
+}
+
+// The def<FPtr, fptr>(...) functions bind the to-be-exposed C++ function at
+// compile time. Thus, the compiler can inline the function into the
+// iteration loop.
+template <
+      class FPtr
+    , FPtr fptr
+    , class KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class A)
+>
+void
+def(
+      python::scope const& sc
+    , char const * name
+    , KW const & kwargs
+    BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, A, const & a)
+)
+{
+    def(sc, name, numpy::detail::static_fctptr<FPtr, fptr>(), kwargs BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
+}
+
+template <
+      class FPtr
+    , FPtr fptr
+    , class KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class A)
+>
+void
+def(
+      char const * name
+    , KW const & kwargs
+    BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, A, const & a)
+)
+{
+    python::scope const sc;
+
+    def(sc, name, numpy::detail::static_fctptr<FPtr, fptr>(), kwargs BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
+}
+
+#if defined(__cpp_nontype_template_parameter_auto)
+template <
+      auto fptr
+    , class KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class A)
+>
+void
+def(
+      python::scope const& sc
+    , char const * name
+    , KW const & kwargs
+    BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, A, const & a)
+)
+{
+    def(sc, name, numpy::detail::static_fctptr<decltype(fptr), fptr>(), kwargs BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
+}
+
+template <
+      auto fptr
+    , class KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class A)
+>
+void
+def(
+      char const * name
+    , KW const & kwargs
+    BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, A, const & a)
+)
+{
+    python::scope const sc;
+
+    def(sc, name, numpy::detail::static_fctptr<decltype(fptr), fptr>(), kwargs BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
+}
+#endif // __cpp_nontype_template_parameter_auto
+
 #else
 #if BOOST_PP_ITERATION_FLAGS() == 4
 
@@ -552,6 +917,90 @@ staticmethod(
     return visitor;
 }
 
+template <
+      class FPtr
+    , FPtr fptr
+    , class KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class A)
+>
+detail::method_visitor<
+      N
+    , numpy::detail::static_fctptr<FPtr, fptr>
+    , KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, A)
+>
+method(
+      char const * name
+    , KW const & kwargs
+    BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, A, const & a)
+)
+{
+    return method(name, numpy::detail::static_fctptr<FPtr, fptr>(), kwargs BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
+}
+
+template <
+      class FPtr
+    , FPtr fptr
+    , class KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class A)
+>
+detail::staticmethod_visitor<
+      N
+    , numpy::detail::static_fctptr<FPtr, fptr>
+    , KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, A)
+>
+staticmethod(
+      char const * name
+    , KW const & kwargs
+    BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, A, const & a)
+)
+{
+    return staticmethod(name, numpy::detail::static_fctptr<FPtr, fptr>(), kwargs BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
+}
+
+#if defined(__cpp_nontype_template_parameter_auto)
+template <
+      auto fptr
+    , class KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class A)
+>
+detail::method_visitor<
+      N
+    , numpy::detail::static_fctptr<decltype(fptr), fptr>
+    , KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, A)
+>
+method(
+      char const * name
+    , KW const & kwargs
+    BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, A, const & a)
+)
+{
+    return method(name, numpy::detail::static_fctptr<decltype(fptr), fptr>(), kwargs BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
+}
+
+template <
+      auto fptr
+    , class KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class A)
+>
+detail::staticmethod_visitor<
+      N
+    , numpy::detail::static_fctptr<decltype(fptr), fptr>
+    , KW
+    BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, A)
+>
+staticmethod(
+      char const * name
+    , KW const & kwargs
+    BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, A, const & a)
+)
+{
+    return staticmethod(name, numpy::detail::static_fctptr<decltype(fptr), fptr>(), kwargs BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, a));
+}
+#endif // __cpp_nontype_template_parameter_auto
+
 #endif // BOOST_PP_ITERATION_FLAGS() == 5
 #endif // BOOST_PP_ITERATION_FLAGS() == 4
 #endif // BOOST_PP_ITERATION_FLAGS() == 3
@@ -0,0 +1,128 @@
+/**
+ * $Id$
+ *
+ * Copyright (C)
+ * 2014 - $Date$
+ *     Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * @file    boost/numpy/dstream/dequantize.hpp
+ * @version $Revision$
+ * @date    $Date$
+ * @author  Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * @brief This file defines the boost::numpy::dstream::dequantize function,
+ *        which adapts a function, whose first argument is of a floating
+ *        point type, to take quantized integer values instead. The values are dequantized
+ *        inside the iteration loop, so the quantized input array is streamed
+ *        with its original (small) element size.
+ *
+ *        This file is distributed under the Boost Software License,
+ *        Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ *        http://www.boost.org/LICENSE_1_0.txt).
+ */
+#if !defined(BOOST_PP_IS_ITERATING)
+
+#ifndef BOOST_NUMPY_DSTREAM_DEQUANTIZE_HPP_INCLUDED
+#define BOOST_NUMPY_DSTREAM_DEQUANTIZE_HPP_INCLUDED
+
+#include <boost/preprocessor/arithmetic/sub.hpp>
+#include <boost/preprocessor/iterate.hpp>
+#include <boost/preprocessor/punctuation/comma_if.hpp>
+#include <boost/preprocessor/repetition/enum_shifted_binary_params.hpp>
+#include <boost/preprocessor/repetition/enum_shifted_params.hpp>
+#include <boost/preprocessor/repetition/enum_params.hpp>
+
+#include <boost/mpl/assert.hpp>
+
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+#include <boost/numpy/limits.hpp>
+#include <boost/numpy/dstream/def.hpp>
+
+namespace boost {
+namespace numpy {
+namespace dstream {
+namespace detail {
+
+/**
+ * The dequantize_first_arg template is a function object calling the function
+ * FPtr. Its first argument is replaced by the three arguments
+ * (q, scale, zero_point) of a quantized value q, which is passed to the
+ * function as scale*(q - zero_point).
+ */
+template <class QuantT, class FPtr>
+struct dequantize_first_arg;
+
+// The quantization parameters add two input arguments.
+#define BOOST_PP_ITERATION_PARAMS_1                                            \
+    (3, (1, BOOST_PP_SUB(BOOST_NUMPY_LIMIT_INPUT_ARITY, 2), <boost/numpy/dstream/dequantize.hpp>))
+#include BOOST_PP_ITERATE()
+
+}// namespace detail
+
+/**
+ * The dequantize function adapts the function f to take a quantized input
+ * value of type QuantT (e.g. int8_t) instead of its first argument, which
+ * must be of a floating point type, followed by the scale and zero point of
+ * the quantization, e.g.
+ *
+ *     dstream::def("f", dstream::dequantize<int8_t>(&f), (bp::args("q"), "scale", "zero_point"));
+ *
+ * The scale and zero point are ordinary arguments of the GUF. Passed as
+ * Python scalars, they are bound as constants of the iteration.
+ */
+template <class QuantT, class FPtr>
+detail::functor_with_signature<
+      detail::dequantize_first_arg<QuantT, FPtr>
+    , typename detail::dequantize_first_arg<QuantT, FPtr>::signature_t
+>
+dequantize(FPtr f)
+{
+    return detail::functor_with_signature<
+                 detail::dequantize_first_arg<QuantT, FPtr>
+               , typename detail::dequantize_first_arg<QuantT, FPtr>::signature_t
+           >(detail::dequantize_first_arg<QuantT, FPtr>(f));
+}
+
+}// namespace dstream
+}// namespace numpy
+}// namespace boost
+
+#endif // !BOOST_NUMPY_DSTREAM_DEQUANTIZE_HPP_INCLUDED
+#else
+
+#define N BOOST_PP_ITERATION()
+
+template <class QuantT, class R, BOOST_PP_ENUM_PARAMS(N, class A)>
+struct dequantize_first_arg<QuantT, R (*)(BOOST_PP_ENUM_PARAMS(N, A))>
+{
+    typedef R (*fptr_t)(BOOST_PP_ENUM_PARAMS(N, A));
+
+    typedef typename remove_cv<typename remove_reference<A0>::type>::type
+            value_t;
+
+    // The dequantized value is computed in the type of the first argument.
+    BOOST_MPL_ASSERT_MSG(is_floating_point<value_t>::value,
+        THE_FIRST_ARGUMENT_OF_A_DEQUANTIZED_FUNCTION_MUST_BE_OF_A_FLOATING_POINT_TYPE, (value_t));
+
+    typedef R signature_t(QuantT, value_t, QuantT BOOST_PP_COMMA_IF(BOOST_PP_SUB(N,1)) BOOST_PP_ENUM_SHIFTED_PARAMS(N, A));
+
+    dequantize_first_arg(fptr_t f)
+      : f_(f)
+    {}
+
+    inline
+    R
+    operator()(QuantT q, value_t scale, QuantT zero_point BOOST_PP_COMMA_IF(BOOST_PP_SUB(N,1)) BOOST_PP_ENUM_SHIFTED_BINARY_PARAMS(N, A, a)) const
+    {
+        return f_(scale*(value_t(q) - value_t(zero_point)) BOOST_PP_COMMA_IF(BOOST_PP_SUB(N,1)) BOOST_PP_ENUM_SHIFTED_PARAMS(N, a));
+    }
+
+    fptr_t f_;
+};
+
+#undef N
+
+#endif // BOOST_PP_IS_ITERATING
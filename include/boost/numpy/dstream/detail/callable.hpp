@@ -24,6 +24,7 @@
 
 #include <boost/preprocessor/iteration/iterate.hpp>
 #include <boost/preprocessor/facilities/intercept.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
 #include <boost/preprocessor/repetition/enum_params.hpp>
 
 #include <boost/mpl/assert.hpp>
@@ -64,8 +65,25 @@ make_self_plus_kwargs(KW const & kwargs)
     return self_plus_kw;
 }
 
+// The fct_arg_type_or_unspecified template yields the type of the Idx-th
+// function argument, or numpy::mpl::unspecified for Idx >= FTypes::arity.
+template <class FTypes, unsigned Idx, bool is_arg = (Idx < FTypes::arity)>
+struct fct_arg_type_or_unspecified
+{
+    typedef numpy::mpl::unspecified
+            type;
+};
+
+template <class FTypes, unsigned Idx>
+struct fct_arg_type_or_unspecified<FTypes, Idx, true>
+{
+    typedef typename numpy::mpl::fct_arg_type<FTypes, Idx>::type
+            type;
+};
+
 template <
       unsigned InArity
+    , class F
     , class FTypes
     , class MappingDefinition
     , class WiringModel
@@ -95,6 +113,7 @@ struct callable_base_select
 
     typedef typename callable_in_arity<
                   MappingDefinition::in::arity
+                , F
                 , FTypes
                 , MappingDefinition
                 , wiring_model_t
@@ -149,14 +168,20 @@ struct callable
         , (KW)                                                                 \
     );
 
-template <class FTypes, class MappingDefinition, class WiringModel, class ThreadAbility>
-struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, ThreadAbility>
+#define BOOST_NUMPY_DSTREAM__fct_arg_type(z, n, data) \
+    typename fct_arg_type_or_unspecified<FTypes, n>::type
+
+template <class F_, class FTypes, class MappingDefinition, class WiringModel, class ThreadAbility>
+struct callable_in_arity<IN_ARITY, F_, FTypes, MappingDefinition, WiringModel, ThreadAbility>
 {
+    // Note: The function can have more arguments than the GUF has input
+    //       arrays, i.e. output arguments.
     typedef numpy::detail::callable_caller<
-              IN_ARITY
+              FTypes::arity
+            , F_
             , typename FTypes::class_type
             , typename FTypes::return_type
-            , BOOST_PP_ENUM_PARAMS_Z(1, IN_ARITY, typename FTypes::arg_type)
+            , BOOST_PP_ENUM(BOOST_NUMPY_LIMIT_INPUT_ARITY, BOOST_NUMPY_DSTREAM__fct_arg_type, ~)
             >
             f_caller_t;
 
@@ -225,6 +250,9 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
                 , self
                 , BOOST_PP_ENUM_PARAMS_Z(1, IN_ARITY, in_obj)
                 , out_obj
+                , python::object()
+                , python::object()
+                , python::object()
                 , nthreads);
         }
     };
@@ -274,6 +302,9 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
                 , self
                 , BOOST_PP_ENUM_PARAMS_Z(1, IN_ARITY, in_obj)
                 , out_obj
+                , python::object()
+                , python::object()
+                , python::object()
                 , nthreads);
         }
     };
@@ -293,6 +324,9 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
                 , BOOST_PP_ENUM_PARAMS_Z(1, IN_ARITY, python::object const & BOOST_PP_INTERCEPT)
                 , unsigned
                 , python::object &
+                , python::object const &
+                , python::object const &
+                , python::object const &
                 >
                 signature_t;
 
@@ -301,7 +335,7 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
 
         template <class KW>
         static
-        python::detail::keywords<KW::size+3>
+        python::detail::keywords<KW::size+6>
         make_kwargs(KW const & kwargs)
         {
             BOOST_NUMPY_DSTREAM__is_correct_number_of_kwargs(KW::size, IN_ARITY)
@@ -309,6 +343,9 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
             return ( make_self_plus_kwargs(kwargs)
                    , python::arg("nthreads")=1
                    , python::arg("out")=python::object()
+                   , python::arg("dtype")=python::object()
+                   , python::arg("order")="K"
+                   , python::arg("where")=python::object()
                    );
         }
 
@@ -318,6 +355,9 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
             , BOOST_PP_ENUM_PARAMS_Z(1, IN_ARITY, python::object const & in_obj)
             , unsigned nthreads
             , python::object & out_obj
+            , python::object const & dtype_obj
+            , python::object const & order_obj
+            , python::object const & where_obj
         ) const
         {
             f_caller_t const f_caller(m_f);
@@ -327,6 +367,9 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
                 , self
                 , BOOST_PP_ENUM_PARAMS_Z(1, IN_ARITY, in_obj)
                 , out_obj
+                , dtype_obj
+                , order_obj
+                , where_obj
                 , nthreads);
         }
     };
@@ -345,6 +388,9 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
                 , typename FTypes::class_type &
                 , BOOST_PP_ENUM_PARAMS_Z(1, IN_ARITY, python::object const & BOOST_PP_INTERCEPT)
                 , python::object &
+                , python::object const &
+                , python::object const &
+                , python::object const &
                 >
                 signature_t;
 
@@ -353,13 +399,16 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
 
         template <class KW>
         static
-        python::detail::keywords<KW::size+2>
+        python::detail::keywords<KW::size+5>
         make_kwargs(KW const & kwargs)
         {
             BOOST_NUMPY_DSTREAM__is_correct_number_of_kwargs(KW::size, IN_ARITY)
 
             return ( make_self_plus_kwargs(kwargs)
                    , python::arg("out")=python::object()
+                   , python::arg("dtype")=python::object()
+                   , python::arg("order")="K"
+                   , python::arg("where")=python::object()
                    );
         }
 
@@ -368,6 +417,9 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
               typename FTypes::class_type & self
             , BOOST_PP_ENUM_PARAMS_Z(1, IN_ARITY, python::object const & in_obj)
             , python::object & out_obj
+            , python::object const & dtype_obj
+            , python::object const & order_obj
+            , python::object const & where_obj
         ) const
         {
             f_caller_t const f_caller(m_f);
@@ -378,6 +430,9 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
                 , self
                 , BOOST_PP_ENUM_PARAMS_Z(1, IN_ARITY, in_obj)
                 , out_obj
+                , dtype_obj
+                , order_obj
+                , where_obj
                 , nthreads);
         }
     };
@@ -395,6 +450,9 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
                   python::object
                 , BOOST_PP_ENUM_PARAMS_Z(1, IN_ARITY, python::object const & BOOST_PP_INTERCEPT)
                 , python::object &
+                , python::object const &
+                , python::object const &
+                , python::object const &
                 >
                 signature_t;
 
@@ -403,13 +461,16 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
 
         template <class KW>
         static
-        python::detail::keywords<KW::size+1>
+        python::detail::keywords<KW::size+4>
         make_kwargs(KW const & kwargs)
         {
             BOOST_NUMPY_DSTREAM__is_correct_number_of_kwargs(KW::size, IN_ARITY)
 
             return ( kwargs
                    , python::arg("out")=python::object()
+                   , python::arg("dtype")=python::object()
+                   , python::arg("order")="K"
+                   , python::arg("where")=python::object()
                    );
         }
 
@@ -417,6 +478,9 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
         operator()(
               BOOST_PP_ENUM_PARAMS_Z(1, IN_ARITY, python::object const & in_obj)
             , python::object & out_obj
+            , python::object const & dtype_obj
+            , python::object const & order_obj
+            , python::object const & where_obj
         ) const
         {
             f_caller_t const f_caller(m_f);
@@ -428,6 +492,9 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
                 , self
                 , BOOST_PP_ENUM_PARAMS_Z(1, IN_ARITY, in_obj)
                 , out_obj
+                , dtype_obj
+                , order_obj
+                , where_obj
                 , nthreads);
         }
     };
@@ -475,6 +542,9 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
                 , self
                 , BOOST_PP_ENUM_PARAMS_Z(1, IN_ARITY, in_obj)
                 , out_obj
+                , python::object()
+                , python::object()
+                , python::object()
                 , nthreads);
         }
     };
@@ -525,6 +595,9 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
                 , self
                 , BOOST_PP_ENUM_PARAMS_Z(1, IN_ARITY, in_obj)
                 , out_obj
+                , python::object()
+                , python::object()
+                , python::object()
                 , nthreads);
         }
     };
@@ -543,6 +616,9 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
                 , BOOST_PP_ENUM_PARAMS_Z(1, IN_ARITY, python::object const & BOOST_PP_INTERCEPT)
                 , unsigned
                 , python::object &
+                , python::object const &
+                , python::object const &
+                , python::object const &
                 >
                 signature_t;
 
@@ -551,7 +627,7 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
 
         template <class KW>
         static
-        python::detail::keywords<KW::size+2>
+        python::detail::keywords<KW::size+5>
         make_kwargs(KW const & kwargs)
         {
             BOOST_NUMPY_DSTREAM__is_correct_number_of_kwargs(KW::size, IN_ARITY)
@@ -559,6 +635,9 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
             return ( kwargs
                    , python::arg("nthreads")=1
                    , python::arg("out")=python::object()
+                   , python::arg("dtype")=python::object()
+                   , python::arg("order")="K"
+                   , python::arg("where")=python::object()
                    );
         }
 
@@ -567,6 +646,9 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
               BOOST_PP_ENUM_PARAMS_Z(1, IN_ARITY, python::object const & in_obj)
             , unsigned nthreads
             , python::object & out_obj
+            , python::object const & dtype_obj
+            , python::object const & order_obj
+            , python::object const & where_obj
         ) const
         {
             f_caller_t const f_caller(m_f);
@@ -577,11 +659,15 @@ struct callable_in_arity<IN_ARITY, FTypes, MappingDefinition, WiringModel, Threa
                 , self
                 , BOOST_PP_ENUM_PARAMS_Z(1, IN_ARITY, in_obj)
                 , out_obj
+                , dtype_obj
+                , order_obj
+                , where_obj
                 , nthreads);
         }
     };
 };
 
+#undef BOOST_NUMPY_DSTREAM__fct_arg_type
 #undef BOOST_NUMPY_DSTREAM__is_correct_number_of_kwargs
 
 #undef IN_ARITY
@@ -22,6 +22,7 @@
 #ifndef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL_HPP_INCLUDED
 #define BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL_HPP_INCLUDED
 
+#include <string>
 #include <vector>
 
 #include <boost/preprocessor/iterate.hpp>
@@ -30,9 +31,12 @@
 #include <boost/preprocessor/repetition/enum_trailing_params.hpp>
 
 #include <boost/mpl/bitor.hpp>
+#include <boost/shared_ptr.hpp>
 #include <boost/thread.hpp>
 
-#include <boost/python/object_fwd.hpp>
+#include <boost/python/extract.hpp>
+#include <boost/python/list.hpp>
+#include <boost/python/object.hpp>
 #include <boost/python/tuple.hpp>
 
 #include <boost/numpy/limits.hpp>
@@ -40,15 +44,228 @@
 #include <boost/numpy/detail/logging.hpp>
 #include <boost/numpy/detail/pygil.hpp>
 #include <boost/numpy/dstream/array_definition.hpp>
+#include <boost/numpy/dstream/copy_monitor.hpp>
 #include <boost/numpy/dstream/detail/input_array_service.hpp>
 #include <boost/numpy/dstream/detail/output_array_service.hpp>
 #include <boost/numpy/dstream/detail/loop_service.hpp>
+#include <boost/numpy/dstream/detail/where_index.hpp>
 
 namespace boost {
 namespace numpy {
 namespace dstream {
 namespace detail {
 
+/**
+ * The get_fields_as_core_dim_view function returns a view of the record array
+ * arr, whose fields are viewed as an additional last dimension of the data
+ * type field_dtype. This is possible, if all fields have this data type and
+ * a constant byte distance. Otherwise, None is returned.
+ */
+inline
+python::object
+get_fields_as_core_dim_view(ndarray const & arr, dtype const & field_dtype)
+{
+    dtype const arr_dtype = arr.get_dtype();
+    python::tuple const field_names = arr_dtype.get_field_names();
+    intptr_t const n_fields = python::len(field_names);
+    if(n_fields == 0) {
+        return python::object();
+    }
+
+    std::vector<intptr_t> const offsets = arr_dtype.get_fields_byte_offsets();
+    intptr_t const field_stride = (n_fields > 1 ? offsets[1] - offsets[0] : field_dtype.get_itemsize());
+    for(intptr_t i=0; i<n_fields; ++i)
+    {
+        if(   ! dtype::equivalent(arr_dtype.get_field_dtype(python::str(field_names[i])), field_dtype)
+           || offsets[i] != offsets[0] + i*field_stride
+          )
+        {
+            return python::object();
+        }
+    }
+
+    std::vector<intptr_t> shape = arr.get_shape_vector();
+    std::vector<intptr_t> strides = arr.get_strides_vector();
+    shape.push_back(n_fields);
+    strides.push_back(field_stride);
+    return from_data(arr.get_data() + offsets[0], field_dtype, shape, strides, &arr);
+}
+
+/**
+ * The make_in_arr function converts the input object of the Idx-th input array
+ * into an ndarray. Usually, it is converted to the data type of the function
+ * argument, which copies the entire array if the data types differ or if the
+ * array is not aligned. Such copies of arrays with more than one element are
+ * recorded by the copy_monitor. With buffered casting, an ndarray with a scalar
+ * core shape and more than one element is passed unchanged, and the iterator
+ * casts its data chunk-wise.
+ */
+template <class WiringModel, unsigned Idx>
+ndarray
+make_in_arr(python::object const & in_obj, dtype const & in_arr_dtype, int in_arr_core_nd)
+{
+    if(is_ndarray(in_obj))
+    {
+        ndarray const arr(python::detail::borrowed_reference(in_obj.ptr()));
+
+        // The fields of a record array are passed as the last core dimension
+        // without copying them, if their layout allows it.
+        if(in_arr_core_nd > 0 && arr.get_dtype().has_fields())
+        {
+            python::object const view = get_fields_as_core_dim_view(arr, in_arr_dtype);
+            if(! view.is_none()) {
+                return make_in_arr<WiringModel, Idx>(view, in_arr_dtype, 0);
+            }
+        }
+
+        intptr_t const size = arr.get_size();
+        if(size > 1)
+        {
+            if(   WiringModel::api::buffered_casting
+               && WiringModel::api::template in_arr_is_buffer_castable<Idx>::type::value
+              )
+            {
+                return arr;
+            }
+
+            bool const dtype_matches = dtype::equivalent(arr.get_dtype(), in_arr_dtype);
+            bool const is_aligned = (arr.get_flags() & numpy::ndarray::ALIGNED);
+            if(! dtype_matches || ! is_aligned)
+            {
+                copy_monitor::record(
+                      Idx
+                    , (dtype_matches ? "misaligned data" : "data type mismatch")
+                    , size * in_arr_dtype.get_itemsize()
+                );
+            }
+        }
+    }
+    return numpy::from_object(in_obj, in_arr_dtype, numpy::ndarray::ALIGNED);
+}
+
+/**
+ * The get_out_arr_dtype function returns the data type of the n-th output
+ * array requested through the dtype keyword argument. A tuple or a list
+ * specifies the data type of each output array individually. None selects the
+ * data type of the function result, value_dtype.
+ */
+inline
+dtype
+get_out_arr_dtype(
+      python::object const & dtype_obj
+    , unsigned out_arity
+    , unsigned n
+    , dtype const & value_dtype
+)
+{
+    python::object dt_obj = dtype_obj;
+    if(PyTuple_Check(dt_obj.ptr()) || PyList_Check(dt_obj.ptr()))
+    {
+        if(python::len(dt_obj) != out_arity)
+        {
+            PyErr_SetString(PyExc_ValueError,
+                "The number of data types given by the dtype argument must "
+                "match the number of output arrays!");
+            python::throw_error_already_set();
+        }
+        dt_obj = dt_obj[n];
+    }
+    if(dt_obj.is_none()) {
+        return value_dtype;
+    }
+    return dtype(dt_obj);
+}
+
+/**
+ * The get_out_arr_order function converts the order keyword argument into the
+ * memory order of newly created output arrays. 'K' keeps the memory order of
+ * the input arrays.
+ */
+inline
+order_t
+get_out_arr_order(python::object const & order_obj)
+{
+    if(! order_obj.is_none())
+    {
+        python::extract<std::string> order_str(order_obj);
+        if(order_str.check())
+        {
+            std::string const order = order_str();
+            if(order == "C" || order == "c") return CORDER;
+            if(order == "F" || order == "f") return FORTRANORDER;
+            if(order == "K" || order == "k") return KEEPORDER;
+        }
+        PyErr_SetString(PyExc_ValueError,
+            "The order argument must be 'C', 'F' or 'K'!");
+        python::throw_error_already_set();
+    }
+    return KEEPORDER;
+}
+
+/**
+ * The get_where_index_in_arr function converts the input object in_obj into
+ * an ndarray without converting its data type. The fields of a record array
+ * are viewed as the last core dimension like by the make_in_arr function.
+ */
+inline
+ndarray
+get_where_index_in_arr(python::object const & in_obj, dtype const & in_arr_dtype, int in_arr_core_nd)
+{
+    ndarray const arr = from_object(in_obj);
+    if(in_arr_core_nd > 0 && arr.get_dtype().has_fields())
+    {
+        python::object const view = get_fields_as_core_dim_view(arr, in_arr_dtype);
+        if(! view.is_none()) {
+            return ndarray(python::detail::borrowed_reference(view.ptr()));
+        }
+    }
+    return arr;
+}
+
+/**
+ * The get_where_index_out_arr function returns the provided output array
+ * object out_obj as ndarray. With indices as where argument, the results are
+ * scattered into it, so it must be an ndarray already.
+ */
+inline
+ndarray
+get_where_index_out_arr(python::object const & out_obj)
+{
+    if(! is_ndarray(out_obj))
+    {
+        PyErr_SetString(PyExc_TypeError,
+            "The output arrays must be numpy arrays, if the where argument "
+            "gives indices!");
+        python::throw_error_already_set();
+    }
+    return ndarray(python::detail::borrowed_reference(out_obj.ptr()));
+}
+
+/**
+ * The get_where_arr_bcr function returns the broadcasting rules of the mask
+ * array of the where argument, i.e. for each loop axis the corresponding axis
+ * of the mask array, or -1 if the mask array is broadcasted along it.
+ */
+inline
+std::vector<int>
+get_where_arr_bcr(ndarray const & where_arr, int loop_nd, bool is_virtual_loop)
+{
+    int const where_nd = where_arr.get_nd();
+    if(where_nd > loop_nd - (is_virtual_loop ? 1 : 0))
+    {
+        PyErr_SetString(PyExc_ValueError,
+            "The where array has more dimensions than the loop!");
+        python::throw_error_already_set();
+    }
+    std::vector<int> bcr(loop_nd);
+    for(int loop_axis=0; loop_axis<loop_nd; ++loop_axis)
+    {
+        int const axis = loop_axis - (loop_nd - where_nd);
+        bcr[loop_axis] = (axis >= 0 ? axis : -1);
+    }
+    return bcr;
+}
+
 template <unsigned OutArity>
 struct construct_result;
 
@@ -180,11 +397,7 @@ struct construct_result<OUT_ARITY>
 #define BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_arr_service(z, n, data)   \
     numpy::dstream::detail::input_array_service<BOOST_PP_CAT(in_arr_def,n)>    \
     BOOST_PP_CAT(in_arr_service,n)(                                            \
-          numpy::from_object(                                                  \
-              BOOST_PP_CAT(in_obj,n)                                           \
-            , BOOST_PP_CAT(in_arr_dtype,n)                                     \
-            , numpy::ndarray::ALIGNED                                          \
-          )                                                                    \
+        make_in_arr<WiringModel, n>(BOOST_PP_CAT(in_obj,n), BOOST_PP_CAT(in_arr_dtype,n), MappingDefinition::in::BOOST_PP_CAT(core_shape_t,n)::nd::value) \
     );
 
 #define BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_arr_iter_op_flags(z, n, data) \
@@ -196,23 +409,71 @@ struct construct_result<OUT_ARITY>
           BOOST_PP_CAT(in_arr_service,n).get_arr()                             \
         , BOOST_PP_CAT(in_arr_iter_op_flags,n)                                 \
         , BOOST_PP_CAT(in_arr_service,n).get_arr_bcr_data()                    \
+        , BOOST_PP_CAT(in_arr_dtype,n)                                         \
     );
 
+#define BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_arr_is_bound(z, n, data) \
+    bool BOOST_PP_CAT(in_arr_is_bound,n) =                                     \
+           WiringModel::api::template in_arr_is_bindable<n>::type::value       \
+        && BOOST_PP_CAT(in_arr_service,n).get_arr().get_size() == 1;
+
+#define BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_arr_is_bound_and(z, n, data) \
+    && BOOST_PP_CAT(in_arr_is_bound,n)
+
+#define BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_bound_iter(z, n, data)    \
+    boost::shared_ptr<numpy::detail::iter> BOOST_PP_CAT(in_bound_iter,n);      \
+    if(BOOST_PP_CAT(in_arr_is_bound,n))                                        \
+    {                                                                          \
+        BOOST_NUMPY_LOG("Bind input array " << n << " as constant argument.")  \
+        BOOST_PP_CAT(in_bound_iter,n).reset(new numpy::detail::iter(           \
+              numpy::detail::iter::flags::NONE::value                          \
+            , order                                                            \
+            , casting                                                          \
+            , loop_service.get_loop_nd()                                       \
+            , &(bound_itershape.front())                                       \
+            , 0                                                                \
+            , BOOST_PP_CAT(in_arr_iter_op,n)                                   \
+        ));                                                                    \
+        BOOST_PP_CAT(in_bound_iter,n)->init_full_iteration();                  \
+    }                                                                          \
+    else                                                                       \
+    {                                                                          \
+        iter_ops.push_back(&BOOST_PP_CAT(in_arr_iter_op,n));                   \
+    }                                                                          \
+    in_bound_iters.push_back(BOOST_PP_CAT(in_bound_iter,n).get());
+
+#define BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_iter_op_ptr(z, n, data)  \
+    iter_ops.push_back(&BOOST_PP_CAT(out_arr_iter_op,n));
+
 #define BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_obj(z, n, data)          \
-    python::object BOOST_PP_CAT(out_obj,n) = (out_obj == python::object() ? python::object() : (MappingDefinition::out::arity == 1 ? out_obj : out_obj[n]));
+    python::object BOOST_PP_CAT(out_obj,n) = (out_obj.ptr() == Py_None ? python::object() : (MappingDefinition::out::arity == 1 ? out_obj : out_obj[n]));
+
+#define BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_arr_dtype(z, n, data) \
+    numpy::dtype const BOOST_PP_CAT(out_arr_dtype,n) = numpy::dtype::get_builtin< typename BOOST_PP_CAT(out_arr_def,n)::value_type >();
 
 #define BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_arr_service(z, n, data)  \
-    numpy::dstream::detail::output_array_service<loop_service_t, BOOST_PP_CAT(out_arr_def,n)> BOOST_PP_CAT(out_arr_service,n)(loop_service, BOOST_PP_CAT(out_obj,n));
+    numpy::dstream::detail::output_array_service<loop_service_t, BOOST_PP_CAT(out_arr_def,n)> \
+    BOOST_PP_CAT(out_arr_service,n)(                                           \
+          loop_service                                                         \
+        , BOOST_PP_CAT(out_obj,n)                                              \
+        , get_out_arr_dtype(dtype_obj, OUT_ARITY, n, BOOST_PP_CAT(out_arr_dtype,n)) \
+        , out_arr_order                                                        \
+    );
 
 #define BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_arr_iter_op_flags(z, n, data) \
     numpy::detail::iter_operand_flags_t BOOST_PP_CAT(out_arr_iter_op_flags,n) = \
-        WiringModel::api::template out_arr_iter_operand_flags<n>::type::value;
+        WiringModel::api::template out_arr_iter_operand_flags<n>::type::value; \
+    if(is_masked) {                                                            \
+        BOOST_PP_CAT(out_arr_iter_op_flags,n) &= ~numpy::detail::iter_operand::flags::WRITEONLY::value; \
+        BOOST_PP_CAT(out_arr_iter_op_flags,n) |= numpy::detail::iter_operand::flags::READWRITE::value; \
+    }
 
 #define BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_arr_iter_op(z, n, data)  \
     numpy::detail::iter_operand BOOST_PP_CAT(out_arr_iter_op,n)(               \
           BOOST_PP_CAT(out_arr_service,n).get_arr()                            \
         , BOOST_PP_CAT(out_arr_iter_op_flags,n)                                \
         , BOOST_PP_CAT(out_arr_service,n).get_arr_bcr_data()                   \
+        , BOOST_PP_CAT(out_arr_dtype,n)                                        \
     );
 
 #define BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_arr_core_shapes(z, n, arr_service) \
@@ -221,6 +482,41 @@ struct construct_result<OUT_ARITY>
 #define BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_arr_core_shapes(z, n, arr_service) \
     in_core_shapes.push_back( BOOST_PP_CAT(arr_service,n).get_arr_core_shape() );
 
+#define BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_arr_indexed(z, n, data)  \
+    in_core_nds.push_back(MappingDefinition::in::BOOST_PP_CAT(core_shape_t,n)::nd::value); \
+    in_arrs.push_back(get_where_index_in_arr(                                  \
+          BOOST_PP_CAT(in_obj,n)                                               \
+        , numpy::dtype::get_builtin<typename WiringModel::api::template in_arr_value_type<n>::type>() \
+        , in_core_nds.back()                                                   \
+    ));
+
+#define BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_obj_gathered(z, n, data) \
+    python::object const BOOST_PP_CAT(in_obj_gathered,n) =                     \
+        index.gather(BOOST_PP_CAT(in_obj,n), in_arrs[n], in_core_nds[n]);
+
+#define BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_obj_gathered(z, n, data) \
+    if(out_obj.ptr() != Py_None)                                               \
+    {                                                                          \
+        ndarray const out_arr = get_where_index_out_arr(BOOST_PP_CAT(out_obj,n)); \
+        out_arrs.append(out_arr);                                              \
+        out_objs_gathered.append(index.gather(out_arr, out_arr, MappingDefinition::out::BOOST_PP_CAT(core_shape_t,n)::nd::value)); \
+    }
+
+#define BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_arr_scattered(z, n, data) \
+    {                                                                          \
+        python::object const values = out_objs_gathered[n];                  \
+        if(out_obj.ptr() == Py_None)                                           \
+        {                                                                      \
+            out_arrs.append(index.create_out_arr(                              \
+                  ndarray(python::detail::borrowed_reference(values.ptr()))    \
+                , MappingDefinition::out::BOOST_PP_CAT(core_shape_t,n)::nd::value \
+                , out_arr_order                                                \
+            ));                                                                \
+        }                                                                      \
+        python::object const out_arr = out_arrs[n];                            \
+        index.scatter(ndarray(python::detail::borrowed_reference(out_arr.ptr())), values); \
+    }
+
 template <>
 struct callable_call_outin_arity<OUT_ARITY, IN_ARITY>
 {
@@ -243,11 +539,30 @@ struct callable_call_outin_arity<OUT_ARITY, IN_ARITY>
             , typename FTypes::class_type & self
             , BOOST_PP_ENUM_PARAMS(IN_ARITY, python::object const & in_obj)
             , python::object & out_obj
+            , python::object const & dtype_obj
+            , python::object const & order_obj
+            , python::object const & where_obj
             , unsigned nthreads
         )
         {
             numpy::detail::PyGIL pygil;
 
+            // An accumulating wiring model combines the function results with
+            // the values of the provided output arrays.
+            if(WiringModel::api::accumulates && out_obj.ptr() == Py_None)
+            {
+                PyErr_SetString(PyExc_ValueError,
+                    "The function accumulates its results into the output "
+                    "array, so the out argument must be given!");
+                python::throw_error_already_set();
+            }
+
+            // Indices as where argument select the loop positions to compute.
+            if(is_where_index(where_obj))
+            {
+                return call_indexed(f_caller, self, BOOST_PP_ENUM_PARAMS(IN_ARITY, in_obj), out_obj, dtype_obj, order_obj, where_obj, nthreads);
+            }
+
             // Construct array_definition types for all input arrays.
             BOOST_PP_REPEAT(IN_ARITY, BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_arr_def, ~)
 
@@ -280,10 +595,40 @@ struct callable_call_outin_arity<OUT_ARITY, IN_ARITY>
             // Construct array_definition types for all output arrays.
             BOOST_PP_REPEAT(OUT_ARITY, BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_arr_def, ~)
 
+            // Construct dtype objects for all output arrays holding the data
+            // types of the function results.
+            BOOST_PP_REPEAT(OUT_ARITY, BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_arr_dtype, ~)
+
             // Construct output_array_service objects for all output arrays.
+            // Newly created output arrays get the data type requested by the
+            // dtype argument. The iterator casts the function results into it.
+            // Their memory order is requested by the order argument.
+            numpy::order_t const out_arr_order = get_out_arr_order(order_obj);
             BOOST_PP_REPEAT(OUT_ARITY, BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_arr_service, ~)
 
+            // An empty loop, e.g. for an empty index as where argument, has
+            // nothing to compute. The iterator does not accept it anyway.
+            if(loop_service.get_loop_size() == 0)
+            {
+                return construct_result<MappingDefinition::out::arity>::apply(out_obj BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, OUT_ARITY, out_arr_service));
+            }
+
+            // The mask array of the where argument selects the loop elements
+            // to compute. It is broadcasted against the loop shape.
+            bool const is_masked = ! where_obj.is_none();
+            ndarray const where_arr = (is_masked
+                ? from_object(where_obj, dtype::get_builtin<bool>(), ndarray::ALIGNED)
+                : from_object(python::object()));
+            std::vector<int> where_arr_bcr;
+            if(is_masked)
+            {
+                where_arr_bcr = get_where_arr_bcr(where_arr, loop_service.get_loop_nd(), loop_service.is_virtual_loop());
+            }
+
             // Construct iter_operand_flags_t objects for all output arrays.
+            // With a mask, the output arrays are opened for reading as well,
+            // so the iterator buffers hold the present values of masked-out
+            // elements and write them back unchanged.
             BOOST_PP_REPEAT(OUT_ARITY, BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_arr_iter_op_flags, ~)
 
             // Construct iter_operand objects for all output arrays.
@@ -307,6 +652,40 @@ struct callable_call_outin_arity<OUT_ARITY, IN_ARITY>
             numpy::casting_t casting = WiringModel::api::casting;
             intptr_t buffersize = WiringModel::api::buffersize;
 
+            // Input arrays with a scalar core shape and only one element,
+            // e.g. Python scalars, are constant during the entire iteration.
+            // They are bound as constant arguments, i.e. they are not operands
+            // of the iterator, but are held by their own (never advanced)
+            // iterator object. Since the iterator needs at least one operand,
+            // not all input arrays can be bound, when there are no output
+            // arrays.
+            BOOST_PP_REPEAT(IN_ARITY, BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_arr_is_bound, ~)
+            #if OUT_ARITY == 0
+            if(true BOOST_PP_REPEAT(IN_ARITY, BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_arr_is_bound_and, ~))
+            {
+                in_arr_is_bound0 = false;
+            }
+            #endif
+
+            std::vector<numpy::detail::iter_operand const *> iter_ops;
+            BOOST_PP_REPEAT(OUT_ARITY, BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_iter_op_ptr, ~)
+
+            std::vector<intptr_t> bound_itershape(loop_service.get_loop_nd(), 1);
+            std::vector<numpy::detail::iter *> in_bound_iters;
+            BOOST_PP_REPEAT(IN_ARITY, BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_bound_iter, ~)
+
+            // The mask array is the last operand of the iterator. The wiring
+            // model recognizes it by the number of iterator operands.
+            numpy::detail::iter_operand where_arr_iter_op(
+                  where_arr
+                , numpy::detail::iter_operand::flags::READONLY::value
+                , (is_masked ? &where_arr_bcr.front() : NULL)
+            );
+            if(is_masked)
+            {
+                iter_ops.push_back(&where_arr_iter_op);
+            }
+
             // Finally, create the iterator object.
             numpy::detail::iter iter(
                   iter_flags
@@ -315,8 +694,7 @@ struct callable_call_outin_arity<OUT_ARITY, IN_ARITY>
                 , loop_service.get_loop_nd()
                 , loop_service.get_loop_shape_data()
                 , buffersize
-                BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, OUT_ARITY, out_arr_iter_op)
-                BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, IN_ARITY, in_arr_iter_op)
+                , iter_ops
             );
 
             bool keep_gil = false;
@@ -416,10 +794,13 @@ struct callable_call_outin_arity<OUT_ARITY, IN_ARITY>
                     boost::thread *t = new boost::thread(
                           &WiringModel::template iterate<typename FTypes::class_type, FCaller>
                         , boost::ref(self)
-                        , boost::cref(f_caller)
+                        // Each thread gets its own copy of the function
+                        // caller, i.e. of the state of a function object.
+                        , f_caller
                         , boost::ref(*it)
                         , boost::cref(out_core_shapes)
                         , boost::cref(in_core_shapes)
+                        , boost::cref(in_bound_iters)
                         , boost::ref(thread_error_flag)
                     );
                     threads.add_thread(t);
@@ -442,6 +823,7 @@ struct callable_call_outin_arity<OUT_ARITY, IN_ARITY>
                 , iter
                 , out_core_shapes
                 , in_core_shapes
+                , in_bound_iters
                 , thread_error_flag
             );
 
@@ -464,15 +846,106 @@ struct callable_call_outin_arity<OUT_ARITY, IN_ARITY>
 
             return construct_result<MappingDefinition::out::arity>::apply(out_obj BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, OUT_ARITY, out_arr_service));
         }
+
+        /**
+         * The call_indexed function evaluates the function only at the loop
+         * positions given by the indices of the where argument. The input
+         * values at these positions, and the present values of the provided
+         * output arrays, are gathered into compact arrays, the function is
+         * called on them (in parallel), and the results are scattered into the
+         * output arrays. Newly created output arrays are zero-initialized.
+         */
+        static
+        python::object
+        call_indexed(
+              FCaller const & f_caller
+            , typename FTypes::class_type & self
+            , BOOST_PP_ENUM_PARAMS(IN_ARITY, python::object const & in_obj)
+            , python::object & out_obj
+            , python::object const & dtype_obj
+            , python::object const & order_obj
+            , python::object const & where_obj
+            , unsigned nthreads
+        )
+        {
+            if(OUT_ARITY == 0)
+            {
+                PyErr_SetString(PyExc_ValueError,
+                    "The where argument can only give indices for functions "
+                    "with output arrays!");
+                python::throw_error_already_set();
+            }
+
+            // Determine the loop shape from the input arrays, which are not
+            // converted to the data types of the function arguments here.
+            std::vector<ndarray> in_arrs;
+            std::vector<int> in_core_nds;
+            BOOST_PP_REPEAT(IN_ARITY, BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_arr_indexed, ~)
+            where_index const index(where_obj, get_where_index_loop_shape(in_arrs, in_core_nds));
+            numpy::order_t const out_arr_order = get_out_arr_order(order_obj);
+
+            BOOST_PP_REPEAT(IN_ARITY, BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_obj_gathered, ~)
+
+            // An accumulating function would combine the result of each
+            // duplicate index with the same gathered output value, and only
+            // the last one would be scattered back.
+            if(WiringModel::api::accumulates && index.has_duplicates())
+            {
+                PyErr_SetString(PyExc_ValueError,
+                    "The where argument must not give a loop position more "
+                    "than once for a function, which accumulates its "
+                    "results!");
+                python::throw_error_already_set();
+            }
+
+            BOOST_PP_REPEAT(OUT_ARITY, BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_obj, ~)
+            python::list out_arrs;
+            python::list out_objs_gathered;
+            BOOST_PP_REPEAT(OUT_ARITY, BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_obj_gathered, ~)
+
+            python::object out_obj_gathered;
+            if(out_obj.ptr() != Py_None) {
+                out_obj_gathered = (OUT_ARITY == 1 ? python::object(out_objs_gathered[0]) : python::object(python::tuple(out_objs_gathered)));
+            }
+            python::object const result = call(
+                  f_caller
+                , self
+                , BOOST_PP_ENUM_PARAMS(IN_ARITY, in_obj_gathered)
+                , out_obj_gathered
+                , dtype_obj
+                , order_obj
+                , python::object()
+                , nthreads
+            );
+            if(out_obj.ptr() == Py_None) {
+                out_objs_gathered = (OUT_ARITY == 1 ? python::list(python::make_tuple(result)) : python::list(result));
+            }
+
+            BOOST_PP_REPEAT(OUT_ARITY, BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_arr_scattered, ~)
+
+            if(out_obj.ptr() != Py_None) {
+                return python::object();
+            }
+            return (OUT_ARITY == 1 ? python::object(out_arrs[0]) : python::object(python::tuple(out_arrs)));
+        }
     };
 };
 
+#undef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_arr_scattered
+#undef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_obj_gathered
+#undef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_obj_gathered
+#undef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_arr_indexed
 #undef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_arr_core_shapes
 #undef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_arr_core_shapes
 #undef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_arr_iter_op
 #undef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_arr_iter_op_flags
 #undef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_arr_service
+#undef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_arr_dtype
 #undef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_obj
+#undef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__out_iter_op_ptr
+#undef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_bound_iter
+#undef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_arr_is_bound_and
+#undef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_arr_is_bound
 #undef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_arr_iter_op
 #undef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_arr_iter_op_flags
 #undef BOOST_NUMPY_DSTREAM_DETAIL_CALLABLE_CALL__in_arr_service
@@ -51,12 +51,12 @@ namespace detail {
 template <unsigned> struct invoke_arity;
 template <unsigned> struct caller_arity;
 
-// The +1 is for the class instance and the +2 is for the possible automatically
-// added extra arguments ("out" and "nthreads").
+// The +1 is for the class instance and the +5 is for the possible automatically
+// added extra arguments ("nthreads", "out", "dtype", "order" and "where").
 // The minimum input arity is forced to be 1 instead of 0 because a vectorized
 // function with no input is just non-sense.
 #define BOOST_PP_ITERATION_PARAMS_1                                            \
-    (3, (1, BOOST_NUMPY_LIMIT_INPUT_ARITY + 1 + 2, <boost/numpy/dstream/detail/caller.hpp>))
+    (3, (1, BOOST_NUMPY_LIMIT_INPUT_ARITY + 1 + 5, <boost/numpy/dstream/detail/caller.hpp>))
 #include BOOST_PP_ITERATE()
 
 template <class Callable>
@@ -24,6 +24,7 @@
 #define BOOST_NUMPY_DSTREAM_DETAIL_LOOP_SERVICE_HPP_INCLUDED
 
 #include <algorithm>
+#include <cstdlib>
 #include <set>
 #include <sstream>
 #include <vector>
@@ -70,6 +71,46 @@ bool operator>(max_loop_shape_selector const & lhs, max_loop_shape_selector cons
     return (lhs.arr_loop_nd_ > rhs.arr_loop_nd_);
 }
 
+// The loop_axis_stride_greater function object orders loop axes by the
+// absolute strides of an array, i.e. from the outermost to the innermost axis
+// in memory.
+struct loop_axis_stride_greater
+{
+    loop_axis_stride_greater(std::vector<intptr_t> const & strides)
+      : strides_(strides)
+    {}
+
+    bool
+    operator()(int lhs, int rhs) const
+    {
+        return (std::abs(strides_[lhs]) > std::abs(strides_[rhs]));
+    }
+
+    std::vector<intptr_t> const & strides_;
+};
+
+/**
+ * The sort_loop_axes_by_memory_order function sorts the loop axes by the
+ * memory layout of the input array of the given input array service. It
+ * returns false and leaves the axes unchanged, when the input array does not
+ * span the entire loop shape, e.g. because it is broadcasted.
+ */
+template <class InArrService>
+bool
+sort_loop_axes_by_memory_order(
+      InArrService const & in_arr_service
+    , std::vector<intptr_t> const & loop_shape
+    , std::vector<int> & axes
+)
+{
+    if(in_arr_service.get_arr_loop_shape() != loop_shape) {
+        return false;
+    }
+    std::vector<intptr_t> const strides = in_arr_service.get_arr().get_strides_vector();
+    std::stable_sort(axes.begin(), axes.end(), loop_axis_stride_greater(strides));
+    return true;
+}
+
 template <int Arity>
 struct loop_service_arity;
 
@@ -263,6 +304,32 @@ struct loop_service_arity<N>
             return _is_virtual_loop;
         }
 
+        /**
+         * \brief Returns the loop axes ordered from the outermost to the
+         *     innermost axis in memory of the first input array that spans
+         *     the entire loop shape. If there is no such input array, the
+         *     loop axes are returned in C order.
+         */
+        std::vector<int>
+        get_loop_axes_memory_order() const
+        {
+            std::vector<int> axes(_loop_shape.size());
+            for(size_t i=0; i<axes.size(); ++i)
+            {
+                axes[i] = i;
+            }
+            if(_is_virtual_loop) {
+                return axes;
+            }
+            // The || operator stops at the first input array that spans the
+            // entire loop shape.
+            #define BOOST_NUMPY_DEF(z, n, data) \
+                BOOST_PP_IF(n, ||, ) sort_loop_axes_by_memory_order(BOOST_PP_CAT(_in_arr_service_,n), _loop_shape, axes)
+            BOOST_PP_REPEAT(N, BOOST_NUMPY_DEF, ~);
+            #undef BOOST_NUMPY_DEF
+            return axes;
+        }
+
       protected:
         std::vector<intptr_t> _loop_shape;
         bool _is_virtual_loop;
@@ -22,13 +22,17 @@
 
 #include <algorithm>
 #include <sstream>
+#include <string>
 #include <vector>
 
 #include <boost/assert.hpp>
+#include <boost/python/extract.hpp>
 #include <boost/python/object_fwd.hpp>
+#include <boost/python/str.hpp>
 
 #include <boost/numpy/dtype.hpp>
 #include <boost/numpy/ndarray.hpp>
+#include <boost/numpy/types.hpp>
 #include <boost/numpy/detail/utils.hpp>
 
 namespace boost {
@@ -57,6 +61,8 @@ class output_array_service
     output_array_service(
           loop_service_t const & loop_service
         , python::object const & out_obj
+        , dtype const &          arr_dtype
+        , order_t                order = KEEPORDER
         , ndarray::flags         flags = ndarray::NONE
     )
       : loop_service_(loop_service)
@@ -116,9 +122,29 @@ class output_array_service
         }
         else
         {
-            // No output array was provided, create a new array.
-            dtype const dt = dtype::get_builtin< value_type >();
-            arr_ = zeros(arr_shape_, dt);
+            // No output array was provided, create a new array with the
+            // requested data type and memory order of the loop dimensions.
+            // The core dimensions are always the innermost dimensions.
+            arr_ = create_arr(arr_dtype, order);
+        }
+
+        // Output values with a scalar core shape are cast by the iterator from
+        // the function result type into the data type of the array. Core
+        // dimensions are accessed through the array strides, so the array
+        // must have the data type of the function result already.
+        if(core_shape_t::nd::value > 0)
+        {
+            dtype const value_dtype = dtype::get_builtin< value_type >();
+            if(! dtype::equivalent(arr_.get_dtype(), value_dtype))
+            {
+                std::stringstream msg;
+                msg << "The output array has core dimensions, so its data "
+                    << "type must be "
+                    << python::extract<std::string>(python::str(value_dtype))()
+                    << "!";
+                PyErr_SetString(PyExc_ValueError, msg.str().c_str());
+                python::throw_error_already_set();
+            }
         }
 
         // Set the broadcasting rules for the output array. By construction all
@@ -172,6 +198,53 @@ class output_array_service
     }
 
   protected:
+    /**
+     * \brief Creates a new array of shape arr_shape_, whose loop dimensions
+     *     are laid out in memory in C order, in Fortran order, or, for
+     *     KEEPORDER, in the order of the input arrays. It is allocated
+     *     C-contiguous with permuted loop dimensions and then transposed
+     *     back, so the iteration over the loop dimensions stays unit-stride.
+     */
+    ndarray
+    create_arr(dtype const & dt, order_t order) const
+    {
+        int const nd = arr_shape_.size();
+        int const loop_nd = nd - core_shape_t::nd::value;
+
+        std::vector<int> loop_axes(loop_nd);
+        if(order == KEEPORDER && ! loop_service_.is_virtual_loop())
+        {
+            loop_axes = loop_service_.get_loop_axes_memory_order();
+        }
+        else
+        {
+            for(int i=0; i<loop_nd; ++i)
+            {
+                loop_axes[i] = (order == FORTRANORDER ? loop_nd-1-i : i);
+            }
+        }
+
+        std::vector<intptr_t> shape(arr_shape_);
+        std::vector<int> axes(nd);
+        bool is_c_order = true;
+        for(int i=0; i<nd; ++i)
+        {
+            axes[i] = i;
+        }
+        for(int j=0; j<loop_nd; ++j)
+        {
+            shape[j] = arr_shape_[loop_axes[j]];
+            axes[loop_axes[j]] = j;
+            is_c_order = is_c_order && (loop_axes[j] == j);
+        }
+
+        ndarray const arr = zeros(shape, dt);
+        if(is_c_order) {
+            return arr;
+        }
+        return arr.transpose(axes);
+    }
+
     loop_service_t const & loop_service_;
     ndarray arr_;
     std::vector<intptr_t> arr_shape_;
@@ -0,0 +1,227 @@
+/**
+ * $Id$
+ *
+ * Copyright (C)
+ * 2014 - $Date$
+ *     Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * @file    boost/numpy/dstream/detail/overload_dispatcher.hpp
+ * @version $Revision$
+ * @date    $Date$
+ * @author  Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * @brief This file defines the overload_set template holding the C++
+ *        functions of a generalized universal function with several overloads,
+ *        and the overload_dispatcher class, which selects the overload to call
+ *        based on the data types of the input arrays.
+ *
+ *        This file is distributed under the Boost Software License,
+ *        Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ *        http://www.boost.org/LICENSE_1_0.txt).
+ */
+#ifndef BOOST_NUMPY_DSTREAM_DETAIL_OVERLOAD_DISPATCHER_HPP_INCLUDED
+#define BOOST_NUMPY_DSTREAM_DETAIL_OVERLOAD_DISPATCHER_HPP_INCLUDED
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <boost/python.hpp>
+
+#include <boost/numpy/detail/logging.hpp>
+#include <boost/numpy/dtype.hpp>
+#include <boost/numpy/ndarray.hpp>
+#include <boost/numpy/mpl/types_from_fctptr_signature.hpp>
+#include <boost/numpy/dstream/mapping/converter/out_arg_types_to_out_mapping.hpp>
+#include <boost/numpy/dstream/wiring/converter/arg_type_to_array_dtype.hpp>
+
+namespace boost {
+namespace numpy {
+namespace dstream {
+namespace detail {
+
+/**
+ * The overload_set template is a compile-time list of the functions given to
+ * the dstream::overloads function. Each node holds one function and the rest
+ * of the list. The list is terminated by the overload_set_end type.
+ */
+struct overload_set_end
+{};
+
+template <class F, class Next>
+struct overload_set
+{
+    overload_set(F f, Next const & next)
+      : m_f(f)
+      , m_next(next)
+    {}
+
+    F    m_f;
+    Next m_next;
+};
+
+template <class F, class Next>
+overload_set<F, Next>
+make_overload_set(F f, Next const & next)
+{
+    return overload_set<F, Next>(f, next);
+}
+
+//==============================================================================
+template <class FTypes, unsigned n>
+struct in_arr_dtypes_collector
+{
+    static
+    void
+    apply(std::vector<dtype> & dtypes)
+    {
+        in_arr_dtypes_collector<FTypes, n-1>::apply(dtypes);
+
+        typedef typename numpy::mpl::fct_arg_type<FTypes, n-1>::type
+                arg_t;
+        typedef typename wiring::converter::detail::arg_type_to_array_dtype<arg_t>::type
+                arr_value_t;
+        dtypes.push_back(dtype::get_builtin<arr_value_t>());
+    }
+};
+
+template <class FTypes>
+struct in_arr_dtypes_collector<FTypes, 0>
+{
+    static
+    void
+    apply(std::vector<dtype> &)
+    {}
+};
+
+/**
+ * The get_in_arr_dtypes function returns the data types of the input arrays
+ * of the function F, i.e. the data types the function is compiled for.
+ */
+template <class F, class Signature>
+std::vector<dtype>
+get_in_arr_dtypes(F, Signature const &)
+{
+    typedef typename numpy::mpl::types_from_fctptr_signature<F, Signature>::type
+            f_types_t;
+
+    std::vector<dtype> dtypes;
+    in_arr_dtypes_collector<
+          f_types_t
+        , f_types_t::arity - mapping::converter::detail::fct_out_arity<f_types_t>::value
+    >::apply(dtypes);
+    return dtypes;
+}
+
+//==============================================================================
+/**
+ * The overload_dispatcher class is the implementation of the Python function
+ * of a set of overloads. It keeps a table of the input array data types of
+ * each overload. When called, it selects the first overload whose input data
+ * types are equivalent to the data types of the passed arrays. If there is
+ * none, it selects the first overload to which all passed arrays can be cast
+ * safely. If there is none either, the first overload is called and the
+ * arrays are cast by numpy as usual. Arguments, which are no numpy arrays or
+ * numpy scalars, e.g. Python scalars or lists, match every data type.
+ */
+class overload_dispatcher
+{
+  public:
+    overload_dispatcher(python::detail::keyword_range const & kwrange)
+    {
+        for(python::detail::keyword const * kw = kwrange.first; kw != kwrange.second; ++kw)
+        {
+            in_names_.push_back(kw->name ? kw->name : "");
+        }
+    }
+
+    void
+    add(python::object const & fct, std::vector<dtype> const & in_arr_dtypes)
+    {
+        fcts_.push_back(fct);
+        in_arr_dtypes_.push_back(in_arr_dtypes);
+    }
+
+    python::object
+    operator()(python::tuple const & args, python::dict const & kwargs) const
+    {
+        // Determine the data types of the passed input arrays. None stands
+        // for an argument without a numpy data type.
+        std::size_t const n_args = python::len(args);
+        std::vector<python::object> arg_dtypes(in_names_.size());
+        for(std::size_t i=0; i<in_names_.size(); ++i)
+        {
+            python::object arg;
+            if(i < n_args) {
+                arg = args[i];
+            }
+            else if(kwargs.has_key(in_names_[i])) {
+                arg = kwargs[in_names_[i]];
+            }
+            else {
+                continue;
+            }
+
+            if(is_ndarray(arg) || is_array_scalar(arg)) {
+                arg_dtypes[i] = arg.attr("dtype");
+            }
+        }
+
+        std::size_t const idx = select(arg_dtypes);
+        BOOST_NUMPY_LOG("Dispatch to overload "<< idx)
+
+        PyObject * result = PyObject_Call(fcts_[idx].ptr(), args.ptr(), kwargs.ptr());
+        return python::object(python::handle<>(result));
+    }
+
+  protected:
+    std::size_t
+    select(std::vector<python::object> const & arg_dtypes) const
+    {
+        for(std::size_t k=0; k<fcts_.size(); ++k)
+        {
+            if(matches(arg_dtypes, in_arr_dtypes_[k], &dtype::equivalent)) {
+                return k;
+            }
+        }
+        for(std::size_t k=0; k<fcts_.size(); ++k)
+        {
+            if(matches(arg_dtypes, in_arr_dtypes_[k], &dtype::can_cast)) {
+                return k;
+            }
+        }
+        return 0;
+    }
+
+    static
+    bool
+    matches(
+          std::vector<python::object> const & arg_dtypes
+        , std::vector<dtype> const & in_arr_dtypes
+        , bool (*pred)(dtype const &, dtype const &)
+    )
+    {
+        for(std::size_t i=0; i<arg_dtypes.size() && i<in_arr_dtypes.size(); ++i)
+        {
+            if(arg_dtypes[i].is_none()) {
+                continue;
+            }
+            dtype const arg_dtype(python::detail::borrowed_reference(arg_dtypes[i].ptr()));
+            if(! pred(arg_dtype, in_arr_dtypes[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<std::string>          in_names_;
+    std::vector<python::object>       fcts_;
+    std::vector< std::vector<dtype> > in_arr_dtypes_;
+};
+
+}// namespace detail
+}// namespace dstream
+}// namespace numpy
+}// namespace boost
+
+#endif // !BOOST_NUMPY_DSTREAM_DETAIL_OVERLOAD_DISPATCHER_HPP_INCLUDED
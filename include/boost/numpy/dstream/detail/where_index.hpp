@@ -0,0 +1,300 @@
+/**
+ * $Id$
+ *
+ * Copyright (C)
+ * 2014 - $Date$
+ *     Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \file    boost/numpy/dstream/detail/where_index.hpp
+ * \version $Revision$
+ * \date    $Date$
+ * \author  Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \brief This file defines the where_index class, which holds the loop
+ *        positions selected by an integer index array given as where argument
+ *        of a generalized universal function. It gathers the input values at
+ *        these positions into compact arrays and scatters the computed results
+ *        back into the output arrays.
+ *
+ *        This file is distributed under the Boost Software License,
+ *        Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ *        http://www.boost.org/LICENSE_1_0.txt).
+ */
+#ifndef BOOST_NUMPY_DSTREAM_DETAIL_WHERE_INDEX_HPP_INCLUDED
+#define BOOST_NUMPY_DSTREAM_DETAIL_WHERE_INDEX_HPP_INCLUDED
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/python/extract.hpp>
+#include <boost/python/import.hpp>
+#include <boost/python/list.hpp>
+#include <boost/python/object.hpp>
+#include <boost/python/tuple.hpp>
+
+#include <boost/numpy/dtype.hpp>
+#include <boost/numpy/ndarray.hpp>
+#include <boost/numpy/types.hpp>
+
+namespace boost {
+namespace numpy {
+namespace dstream {
+namespace detail {
+
+/**
+ * The is_where_index function returns true, if the where argument selects
+ * loop positions by indices instead of a boolean mask, i.e. if it is a tuple
+ * of index arrays (a multi-index) or an array of integer (flat) indices. An
+ * empty sequence, e.g. an empty list, selects no loop position, even though
+ * numpy converts it into a floating point array.
+ */
+inline
+bool
+is_where_index(python::object const & where_obj)
+{
+    if(where_obj.is_none()) {
+        return false;
+    }
+    if(PyTuple_Check(where_obj.ptr())) {
+        return true;
+    }
+    if(! is_ndarray(where_obj) && PySequence_Check(where_obj.ptr()) && PySequence_Size(where_obj.ptr()) == 0) {
+        return true;
+    }
+    char const kind = (is_ndarray(where_obj)
+        ? ndarray(python::detail::borrowed_reference(where_obj.ptr())).get_dtype().get_char()
+        : from_object(where_obj).get_dtype().get_char());
+    return (kind == 'i' || kind == 'u');
+}
+
+/**
+ * The get_where_index_loop_shape function returns the loop shape of the
+ * input arrays, i.e. the broadcasted shape of their dimensions without their
+ * core dimensions.
+ */
+inline
+std::vector<intptr_t>
+get_where_index_loop_shape(
+      std::vector<ndarray> const & arrs
+    , std::vector<int> const & core_nds
+)
+{
+    std::vector<intptr_t> loop_shape;
+    for(size_t i=0; i<arrs.size(); ++i)
+    {
+        int const arr_loop_nd = std::max(0, arrs[i].get_nd() - core_nds[i]);
+        if(arr_loop_nd > int(loop_shape.size())) {
+            loop_shape.insert(loop_shape.begin(), arr_loop_nd - loop_shape.size(), 1);
+        }
+        int const offset = loop_shape.size() - arr_loop_nd;
+        for(int axis=0; axis<arr_loop_nd; ++axis)
+        {
+            intptr_t const len = arrs[i].get_shape()[axis];
+            intptr_t & loop_len = loop_shape[offset + axis];
+            if(loop_len == 1) {
+                loop_len = len;
+            }
+            else if(len != 1 && len != loop_len)
+            {
+                PyErr_SetString(PyExc_ValueError,
+                    "The input arrays cannot be broadcasted to a common loop "
+                    "shape!");
+                python::throw_error_already_set();
+            }
+        }
+    }
+    return loop_shape;
+}
+
+/**
+ * The where_index class holds one intp index array for each loop dimension.
+ * Flat indices are converted into such a multi-index with respect to the C
+ * order of the loop shape. Negative indices count from the end.
+ */
+class where_index
+{
+  public:
+    where_index(python::object const & where_obj, std::vector<intptr_t> const & loop_shape)
+      : loop_shape_(loop_shape)
+    {
+        int const loop_nd = loop_shape_.size();
+        if(loop_nd == 0)
+        {
+            PyErr_SetString(PyExc_ValueError,
+                "The where argument can only give indices, if there is at "
+                "least one loop dimension!");
+            python::throw_error_already_set();
+        }
+
+        dtype const intp_dtype = dtype::get_builtin<intptr_t>();
+        python::list index;
+        if(PyTuple_Check(where_obj.ptr()))
+        {
+            if(python::len(where_obj) != loop_nd)
+            {
+                PyErr_SetString(PyExc_ValueError,
+                    "The where argument must give one index array for each "
+                    "loop dimension!");
+                python::throw_error_already_set();
+            }
+            for(int axis=0; axis<loop_nd; ++axis)
+            {
+                index.append(from_object(where_obj[axis], intp_dtype, ndarray::ALIGNED));
+            }
+        }
+        else
+        {
+            ndarray const flat = from_object(where_obj, intp_dtype, ndarray::CARRAY_RO);
+            intptr_t const size = flat.get_size();
+            intptr_t loop_size = 1;
+            for(int axis=0; axis<loop_nd; ++axis)
+            {
+                loop_size *= loop_shape_[axis];
+            }
+
+            std::vector<ndarray> arrs;
+            std::vector<intptr_t *> data;
+            for(int axis=0; axis<loop_nd; ++axis)
+            {
+                arrs.push_back(empty(flat.get_shape_vector(), intp_dtype));
+                data.push_back(reinterpret_cast<intptr_t *>(arrs.back().get_data()));
+                index.append(arrs.back());
+            }
+            intptr_t const * flat_data = reinterpret_cast<intptr_t const *>(flat.get_data());
+            for(intptr_t k=0; k<size; ++k)
+            {
+                intptr_t i = flat_data[k];
+                if(i < 0) {
+                    i += loop_size;
+                }
+                if(i < 0 || i >= loop_size)
+                {
+                    PyErr_SetString(PyExc_IndexError,
+                        "An index of the where argument is out of bounds!");
+                    python::throw_error_already_set();
+                }
+                for(int axis=loop_nd-1; axis>=0; --axis)
+                {
+                    data[axis][k] = i % loop_shape_[axis];
+                    i /= loop_shape_[axis];
+                }
+            }
+        }
+        index_ = python::tuple(index);
+    }
+
+    /**
+     * \brief Returns the values of the array arr at the selected loop
+     *     positions as a compact array, whose loop dimensions are the
+     *     dimensions of the index arrays. The array is broadcasted against the
+     *     loop shape first, without copying it. An array without loop
+     *     dimensions is constant for all loop positions, so its object
+     *     arr_obj is returned unchanged.
+     */
+    python::object
+    gather(python::object const & arr_obj, ndarray const & arr, int core_nd) const
+    {
+        int const nd = arr.get_nd();
+        int const arr_loop_nd = std::max(0, nd - core_nd);
+        if(arr_loop_nd == 0) {
+            return arr_obj;
+        }
+
+        int const loop_nd = loop_shape_.size();
+        std::vector<intptr_t> shape(loop_shape_);
+        std::vector<intptr_t> strides(loop_nd, 0);
+        for(int axis=0; axis<arr_loop_nd; ++axis)
+        {
+            if(arr.get_shape()[axis] != 1) {
+                strides[loop_nd - arr_loop_nd + axis] = arr.get_strides()[axis];
+            }
+        }
+        for(int axis=arr_loop_nd; axis<nd; ++axis)
+        {
+            shape.push_back(arr.get_shape()[axis]);
+            strides.push_back(arr.get_strides()[axis]);
+        }
+        ndarray const view = from_data(
+              static_cast<void const *>(arr.get_data())
+            , arr.get_dtype()
+            , shape
+            , strides
+            , &arr
+        );
+
+        return python::object(python::handle<>(PyObject_GetItem(view.ptr(), index_.ptr())));
+    }
+
+    /**
+     * \brief Returns true, if a loop position is selected more than once.
+     *     The indices must have been checked against the loop shape already,
+     *     e.g. by gathering an array with them.
+     */
+    bool
+    has_duplicates() const
+    {
+        python::object const np = python::import("numpy");
+        python::list loop_shape;
+        for(size_t axis=0; axis<loop_shape_.size(); ++axis)
+        {
+            loop_shape.append(loop_shape_[axis]);
+        }
+        python::object const flat = np.attr("ravel_multi_index")(index_, python::tuple(loop_shape), "wrap");
+        return (python::len(np.attr("unique")(flat)) != python::extract<intptr_t>(flat.attr("size"))());
+    }
+
+    /**
+     * \brief Writes the compact array values into the output array arr at the
+     *     selected loop positions.
+     */
+    void
+    scatter(ndarray const & arr, python::object const & values) const
+    {
+        if(PyObject_SetItem(arr.ptr(), index_.ptr(), values.ptr()) == -1) {
+            python::throw_error_already_set();
+        }
+    }
+
+    /**
+     * \brief Creates a zero-initialized output array spanning the entire loop
+     *     shape for the compact result array values, which has core_nd core
+     *     dimensions. The core dimensions are the innermost, C-contiguous
+     *     dimensions. Only the Fortran order reverses the loop dimensions.
+     */
+    ndarray
+    create_out_arr(ndarray const & values, int core_nd, order_t order) const
+    {
+        int const loop_nd = loop_shape_.size();
+        int const nd = loop_nd + core_nd;
+        std::vector<intptr_t> shape(nd);
+        std::vector<int> axes(nd);
+        for(int axis=0; axis<loop_nd; ++axis)
+        {
+            int const loop_axis = (order == FORTRANORDER ? loop_nd-1-axis : axis);
+            shape[axis] = loop_shape_[loop_axis];
+            axes[loop_axis] = axis;
+        }
+        for(int axis=loop_nd; axis<nd; ++axis)
+        {
+            shape[axis] = values.get_shape()[values.get_nd() - nd + axis];
+            axes[axis] = axis;
+        }
+
+        ndarray const arr = zeros(shape, values.get_dtype());
+        if(order != FORTRANORDER || loop_nd == 1) {
+            return arr;
+        }
+        return arr.transpose(axes);
+    }
+
+  protected:
+    std::vector<intptr_t> loop_shape_;
+    python::tuple index_;
+};
+
+}// namespace detail
+}// namespace dstream
+}// namespace numpy
+}// namespace boost
+
+#endif // !BOOST_NUMPY_DSTREAM_DETAIL_WHERE_INDEX_HPP_INCLUDED
@@ -27,13 +27,19 @@
 #include <boost/preprocessor/repetition/repeat.hpp>
 
 #include <boost/mpl/assert.hpp>
+#include <boost/mpl/eval_if.hpp>
 #include <boost/mpl/if.hpp>
 #include <boost/type_traits/is_same.hpp>
 #include <boost/type_traits/is_scalar.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <boost/type_traits/remove_cv.hpp>
 
 #include <boost/python/tuple.hpp>
 
+#include <boost/numpy/mpl/is_fixed_size_array.hpp>
+#include <boost/numpy/mpl/is_scalar.hpp>
 #include <boost/numpy/mpl/is_std_vector.hpp>
+#include <boost/numpy/dstream/array_view.hpp>
 #include <boost/numpy/dstream/dim.hpp>
 
 #include <boost/numpy/dstream/mapping/detail/core_shape.hpp>
@@ -65,6 +71,53 @@ struct scalar_arg_type_to_core_shape
 template <class T, unsigned nd>
 struct std_vector_arg_type_to_core_shape;
 
+template <class ArrayViewT>
+struct array_view_arg_type_to_core_shape;
+
+// A two-dimensional fixed-size array, i.e. a fixed-size array of fixed-size
+// arrays of scalars, has the fixed core shape (N, M).
+template <class T>
+struct fixed_size_array2d_arg_type_to_core_shape
+{
+    typedef typename remove_cv<typename T::value_type>::type
+            array_value_t;
+    typedef typename remove_cv<typename array_value_t::value_type>::type
+            array_bare_value_t;
+
+    typedef typename boost::mpl::if_<
+              typename numpy::mpl::is_scalar<array_bare_value_t>::type
+            , mapping::detail::core_shape<2>::shape< numpy::mpl::fixed_size_array_size<T>::value, numpy::mpl::fixed_size_array_size<array_value_t>::value >
+
+            , numpy::mpl::unspecified
+            >::type
+            type;
+};
+
+// A fixed-size array of scalars, i.e. a boost::array<T, N> or a
+// std::array<T, N>, has the fixed core shape (N). Its length is known at
+// compile time.
+template <class T>
+struct fixed_size_array_arg_type_to_core_shape
+{
+    typedef typename remove_cv<typename remove_reference<T>::type>::type
+            array_t;
+    typedef typename remove_cv<typename array_t::value_type>::type
+            array_bare_value_t;
+
+    typedef typename boost::mpl::if_<
+              typename numpy::mpl::is_scalar<array_bare_value_t>::type
+            , mapping::detail::core_shape<1>::shape< numpy::mpl::fixed_size_array_size<array_t>::value >
+
+            , typename boost::mpl::eval_if<
+                typename numpy::mpl::is_fixed_size_array<array_bare_value_t>::type
+              , fixed_size_array2d_arg_type_to_core_shape<array_t>
+
+              , numpy::mpl::unspecified
+              >::type
+            >::type
+            type;
+};
+
 // Define nd specializations for dimensions J to Z, i.e. up to 18 dimensions.
 #define BOOST_PP_ITERATION_PARAMS_1                                            \
     (4, (1, 18, <boost/numpy/dstream/mapping/converter/arg_type_to_core_shape.hpp>, 1))
@@ -81,7 +134,7 @@ struct select_arg_type_to_core_shape
     //       evaluated. But the evaluation must happen AFTER the converter was
     //       selected.
     typedef typename boost::mpl::if_<
-              typename is_scalar<bare_t>::type
+              typename numpy::mpl::is_scalar<bare_t>::type
             , scalar_arg_type_to_core_shape<T>
 
             , typename boost::mpl::if_<
@@ -89,10 +142,20 @@ struct select_arg_type_to_core_shape
               , scalar_arg_type_to_core_shape<T>
 
               , typename boost::mpl::if_<
-                  typename numpy::mpl::is_std_vector<bare_t>::type
+                  typename numpy::mpl::is_std_vector<typename remove_cv<bare_t>::type>::type
                 , std_vector_arg_type_to_core_shape<T, 1>
 
-                , numpy::mpl::unspecified
+                , typename boost::mpl::if_<
+                    typename dstream::is_array_view<bare_t>::type
+                  , array_view_arg_type_to_core_shape<typename remove_const<bare_t>::type>
+
+                  , typename boost::mpl::if_<
+                      typename numpy::mpl::is_fixed_size_array<typename remove_cv<bare_t>::type>::type
+                    , fixed_size_array_arg_type_to_core_shape<T>
+
+                    , numpy::mpl::unspecified
+                    >::type
+                  >::type
                 >::type
               >::type
             >::type
@@ -139,7 +202,7 @@ struct std_vector_arg_type_to_core_shape<T, ND>
     #define BOOST_NUMPY_DSTREAM_DEF(z, n, data) \
         BOOST_PP_COMMA_IF(n) dim::I - n
     typedef typename boost::mpl::if_<
-              typename is_scalar<vector_bare_value_t>::type
+              typename numpy::mpl::is_scalar<vector_bare_value_t>::type
             , mapping::detail::core_shape<ND>::shape< BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_DEF, ~) >
 
             , typename boost::mpl::if_<
@@ -158,6 +221,16 @@ struct std_vector_arg_type_to_core_shape<T, ND>
     #undef BOOST_NUMPY_DSTREAM_DEF
 };
 
+template <class T>
+struct array_view_arg_type_to_core_shape< dstream::array_view<T, ND> >
+{
+    #define BOOST_NUMPY_DSTREAM_DEF(z, n, data) \
+        BOOST_PP_COMMA_IF(n) dim::I - n
+    typedef mapping::detail::core_shape<ND>::shape< BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_DEF, ~) >
+            type;
+    #undef BOOST_NUMPY_DSTREAM_DEF
+};
+
 #undef ND
 
 #endif // BOOST_PP_ITERATION_FLAGS() == 1
@@ -0,0 +1,174 @@
+/**
+ * $Id$
+ *
+ * Copyright (C)
+ * 2014 - $Date$
+ *     Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \file    boost/numpy/dstream/mapping/converter/out_arg_types_to_out_mapping.hpp
+ * \version $Revision$
+ * \date    $Date$
+ * \author  Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \brief This file defines the out_arg_types_to_out_mapping template for
+ *        converting the output argument types of a function to an output
+ *        mapping type. Output arguments are the trailing arguments of a
+ *        function returning void, for which the is_out_arg_type template
+ *        evaluates to true, i.e. non-const references to scalars and array
+ *        views with a mutable value type. They refer directly to the data of
+ *        the output arrays.
+ *
+ *        This file is distributed under the Boost Software License,
+ *        Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ *        http://www.boost.org/LICENSE_1_0.txt).
+ */
+#if !BOOST_PP_IS_ITERATING
+
+#ifndef BOOST_NUMPY_DSTREAM_MAPPING_CONVERTER_OUT_ARG_TYPES_TO_OUT_MAPPING_HPP_INCLUDED
+#define BOOST_NUMPY_DSTREAM_MAPPING_CONVERTER_OUT_ARG_TYPES_TO_OUT_MAPPING_HPP_INCLUDED
+
+#include <boost/preprocessor/iterate.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
+
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/next.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/type_traits/is_const.hpp>
+#include <boost/type_traits/is_scalar.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+
+#include <boost/numpy/limits.hpp>
+#include <boost/numpy/mpl/is_scalar.hpp>
+#include <boost/numpy/mpl/types_from_fctptr_signature.hpp>
+#include <boost/numpy/dstream/array_view.hpp>
+#include <boost/numpy/dstream/mapping/detail/out.hpp>
+#include <boost/numpy/dstream/mapping/converter/arg_type_to_core_shape.hpp>
+
+namespace boost {
+namespace numpy {
+namespace dstream {
+namespace mapping {
+namespace converter {
+
+namespace detail {
+
+template <class T>
+struct is_mutable_array_view
+  : boost::mpl::false_
+{};
+
+// A view with a mutable value type refers to the data of an output array.
+template <class T, unsigned nd>
+struct is_mutable_array_view< dstream::array_view<T, nd> >
+  : boost::mpl::bool_< ! is_const<T>::value >
+{};
+
+template <class T>
+struct is_builtin_out_arg_type
+  : is_mutable_array_view<typename remove_cv<T>::type>
+{};
+
+// A non-const reference to a scalar refers to an element of an output array.
+template <class T>
+struct is_builtin_out_arg_type<T &>
+  : boost::mpl::or_<
+        boost::mpl::and_< numpy::mpl::is_scalar<T>, boost::mpl::not_< is_const<T> > >
+      , is_mutable_array_view<typename remove_cv<T>::type>
+    >
+{};
+
+}// namespace detail
+
+/**
+ * The is_out_arg_type template evaluates to boost::mpl::true_ if the
+ * function argument type T is an output argument type, i.e. the function
+ * writes its result through an argument of this type into the output array.
+ * It can be specialized for user defined argument types.
+ */
+template <class T, class Enable=void>
+struct is_out_arg_type
+  : detail::is_builtin_out_arg_type<T>::type
+{};
+
+namespace detail {
+
+template <class FTypes, unsigned n>
+struct count_trailing_out_args
+{
+    typedef typename numpy::mpl::fct_arg_type<FTypes, n-1>::type
+            arg_t;
+
+    typedef typename boost::mpl::eval_if<
+              typename converter::is_out_arg_type<arg_t>::type
+            , boost::mpl::next<typename count_trailing_out_args<FTypes, n-1>::type>
+            , boost::mpl::int_<0>
+            >::type
+            type;
+};
+
+template <class FTypes>
+struct count_trailing_out_args<FTypes, 0>
+{
+    typedef boost::mpl::int_<0>
+            type;
+};
+
+/**
+ * The fct_out_arity template determines the number of output arguments of a
+ * function, i.e. the number of its trailing arguments of output argument
+ * type. Only functions returning void can have output arguments.
+ */
+template <class FTypes>
+struct fct_out_arity
+{
+    typedef typename boost::mpl::eval_if_c<
+              FTypes::has_void_return
+            , count_trailing_out_args<FTypes, FTypes::arity>
+            , boost::mpl::int_<0>
+            >::type
+            type;
+
+    BOOST_STATIC_CONSTANT(unsigned, value = type::value);
+};
+
+template <class FTypes, unsigned OutArity>
+struct out_arg_types_to_out_mapping;
+
+#define BOOST_PP_ITERATION_PARAMS_1                                            \
+    (4, (1, BOOST_NUMPY_LIMIT_OUTPUT_ARITY, <boost/numpy/dstream/mapping/converter/out_arg_types_to_out_mapping.hpp>, 1))
+#include BOOST_PP_ITERATE()
+
+}// namespace detail
+}// namespace converter
+}// namespace mapping
+}// namespace dstream
+}// namespace numpy
+}// namespace boost
+
+#endif // !BOOST_NUMPY_DSTREAM_MAPPING_CONVERTER_OUT_ARG_TYPES_TO_OUT_MAPPING_HPP_INCLUDED
+#else
+
+#if BOOST_PP_ITERATION_FLAGS() == 1
+
+#define OUT_ARITY BOOST_PP_ITERATION()
+
+template <class FTypes>
+struct out_arg_types_to_out_mapping<FTypes, OUT_ARITY>
+{
+    #define BOOST_NUMPY_DSTREAM_DEF(z, n, data) \
+        typename arg_type_to_core_shape<typename numpy::mpl::fct_arg_type<FTypes, FTypes::arity - OUT_ARITY + n>::type>::type
+    typedef mapping::detail::out<OUT_ARITY>::core_shapes< BOOST_PP_ENUM(OUT_ARITY, BOOST_NUMPY_DSTREAM_DEF, ~) >
+            type;
+    #undef BOOST_NUMPY_DSTREAM_DEF
+};
+
+#undef OUT_ARITY
+
+#endif // BOOST_PP_ITERATION_FLAGS() == 1
+
+#endif // BOOST_PP_IS_ITERATING
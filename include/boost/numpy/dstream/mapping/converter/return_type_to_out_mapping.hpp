@@ -24,15 +24,22 @@
 
 #include <boost/preprocessor/arithmetic/add.hpp>
 #include <boost/preprocessor/iterate.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
 #include <boost/preprocessor/repetition/repeat.hpp>
 
 #include <boost/mpl/assert.hpp>
+#include <boost/mpl/eval_if.hpp>
 #include <boost/mpl/if.hpp>
 #include <boost/type_traits/is_same.hpp>
 #include <boost/type_traits/is_scalar.hpp>
+#include <boost/type_traits/remove_cv.hpp>
 #include <boost/type_traits/remove_reference.hpp>
 
+#include <boost/numpy/limits.hpp>
+#include <boost/numpy/mpl/is_fixed_size_array.hpp>
+#include <boost/numpy/mpl/is_scalar.hpp>
 #include <boost/numpy/mpl/is_std_vector_of_scalar.hpp>
+#include <boost/numpy/mpl/is_tuple.hpp>
 #include <boost/numpy/dstream/dim.hpp>
 #include <boost/numpy/dstream/mapping/detail/out.hpp>
 #include <boost/numpy/dstream/mapping/detail/core_shape.hpp>
@@ -76,18 +83,85 @@ struct std_vector_return_type_to_out_mapping;
     (4, (1, 18, <boost/numpy/dstream/mapping/converter/return_type_to_out_mapping.hpp>, 1))
 #include BOOST_PP_ITERATE()
 
+// A two-dimensional fixed-size array, i.e. a fixed-size array of fixed-size
+// arrays of scalars, has the fixed core shape (N, M).
+template <class T>
+struct fixed_size_array2d_return_type_to_out_mapping
+{
+    typedef typename remove_cv<typename T::value_type>::type
+            array_value_t;
+    typedef typename remove_cv<typename array_value_t::value_type>::type
+            array_bare_value_t;
+
+    typedef typename boost::mpl::if_<
+              typename numpy::mpl::is_scalar<array_bare_value_t>::type
+            , mapping::detail::out<1>::core_shapes< mapping::detail::core_shape<2>::shape< numpy::mpl::fixed_size_array_size<T>::value, numpy::mpl::fixed_size_array_size<array_value_t>::value > >
+
+            , numpy::mpl::unspecified
+            >::type
+            type;
+};
+
+// A fixed-size array of scalars, i.e. a boost::array<T, N> or a
+// std::array<T, N>, has a fixed core shape known at compile time. Thus, no
+// explicit mapping definition is required.
+template <class T>
+struct fixed_size_array_return_type_to_out_mapping
+{
+    typedef typename remove_cv<typename remove_reference<T>::type>::type
+            array_t;
+    typedef typename remove_cv<typename array_t::value_type>::type
+            array_bare_value_t;
+
+    typedef typename boost::mpl::if_<
+              typename numpy::mpl::is_scalar<array_bare_value_t>::type
+            , mapping::detail::out<1>::core_shapes< mapping::detail::core_shape<1>::shape< numpy::mpl::fixed_size_array_size<array_t>::value > >
+
+            , typename boost::mpl::eval_if<
+                typename numpy::mpl::is_fixed_size_array<array_bare_value_t>::type
+              , fixed_size_array2d_return_type_to_out_mapping<array_t>
+
+              , numpy::mpl::unspecified
+              >::type
+            >::type
+            type;
+};
+
+// A tuple of N scalars is mapped to N scalar output arrays, whose data types
+// are given by the individual tuple element types.
+template <class T, unsigned N>
+struct tuple_return_type_to_out_mapping_impl
+{
+    typedef numpy::mpl::unspecified
+            type;
+};
+
+#define BOOST_PP_ITERATION_PARAMS_1                                            \
+    (4, (1, BOOST_NUMPY_LIMIT_OUTPUT_ARITY, <boost/numpy/dstream/mapping/converter/return_type_to_out_mapping.hpp>, 2))
+#include BOOST_PP_ITERATE()
+
+template <class T>
+struct tuple_return_type_to_out_mapping
+  : tuple_return_type_to_out_mapping_impl<
+        T
+      , numpy::mpl::tuple_size<typename remove_cv<typename remove_reference<T>::type>::type>::value
+    >
+{};
+
 template <class T>
 struct select_return_type_to_out_mapping
 {
     typedef typename remove_reference<T>::type
             bare_t;
+    typedef typename remove_cv<bare_t>::type
+            bare_nocv_t;
 
     typedef typename boost::mpl::if_<
               typename is_same<bare_t, void>::type
             , void_to_out_mapping<T>
 
             , typename boost::mpl::if_<
-                typename is_scalar<bare_t>::type
+                typename numpy::mpl::is_scalar<bare_t>::type
               , scalar_return_type_to_out_mapping<T>
 
               , typename boost::mpl::if_<
@@ -98,7 +172,17 @@ struct select_return_type_to_out_mapping
                     typename numpy::mpl::is_std_vector<T>::type
                   , std_vector_return_type_to_out_mapping<T, 1>
 
-                  , numpy::mpl::unspecified
+                  , typename boost::mpl::if_<
+                      typename numpy::mpl::is_fixed_size_array<bare_nocv_t>::type
+                    , fixed_size_array_return_type_to_out_mapping<T>
+
+                    , typename boost::mpl::if_<
+                        typename numpy::mpl::is_tuple<bare_nocv_t>::type
+                      , tuple_return_type_to_out_mapping<T>
+
+                      , numpy::mpl::unspecified
+                      >::type
+                    >::type
                   >::type
                 >::type
               >::type
@@ -147,7 +231,7 @@ struct std_vector_return_type_to_out_mapping<T, ND>
     #define BOOST_NUMPY_DSTREAM_DEF(z, n, data) \
         BOOST_PP_COMMA_IF(n) dim::I - n
     typedef typename boost::mpl::if_<
-              typename is_scalar<vector_bare_value_t>::type
+              typename numpy::mpl::is_scalar<vector_bare_value_t>::type
             , mapping::detail::out<1>::core_shapes< mapping::detail::core_shape<ND>::shape< BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_DEF, ~) > >
 
             , typename boost::mpl::if_<
@@ -168,6 +252,22 @@ struct std_vector_return_type_to_out_mapping<T, ND>
 
 #undef ND
 
-#endif // BOOST_PP_ITERATION_FLAGS() == 1
+#elif BOOST_PP_ITERATION_FLAGS() == 2
+
+#define OUT_ARITY BOOST_PP_ITERATION()
+
+template <class T>
+struct tuple_return_type_to_out_mapping_impl<T, OUT_ARITY>
+{
+    #define BOOST_NUMPY_DSTREAM_DEF(z, n, data) \
+        mapping::detail::core_shape<0>::shape<>
+    typedef mapping::detail::out<OUT_ARITY>::core_shapes< BOOST_PP_ENUM(OUT_ARITY, BOOST_NUMPY_DSTREAM_DEF, ~) >
+            type;
+    #undef BOOST_NUMPY_DSTREAM_DEF
+};
+
+#undef OUT_ARITY
+
+#endif // BOOST_PP_ITERATION_FLAGS() == 2
 
 #endif // BOOST_PP_IS_ITERATING
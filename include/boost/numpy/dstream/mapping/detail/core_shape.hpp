@@ -25,8 +25,13 @@
 #ifndef BOOST_NUMPY_DSTREAM_MAPPING_DETAIL_CORE_SHAPE_HPP_INCLUDED
 #define BOOST_NUMPY_DSTREAM_MAPPING_DETAIL_CORE_SHAPE_HPP_INCLUDED
 
+#include <stdint.h>
+
+#include <vector>
+
 #include <boost/preprocessor/iterate.hpp>
 #include <boost/preprocessor/punctuation/comma_if.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
 #include <boost/preprocessor/repetition/enum_params.hpp>
 #include <boost/preprocessor/repetition/repeat.hpp>
 
@@ -70,6 +75,26 @@ struct is_core_shape
     BOOST_STATIC_CONSTANT(bool, value = type::value);
 };
 
+// The core_shape_ids template provides the ids of the core shape description
+// MPL vector ShapeVec as a static constant array. It is initialized with
+// constant expressions, so no code is executed to build it.
+template <class ShapeVec, int ND>
+struct core_shape_ids;
+
+// A scalar core shape has no ids. The dummy entry avoids an array of size 0.
+template <class ShapeVec>
+struct core_shape_ids<ShapeVec, 0>
+{
+    static int const value[1];
+};
+
+template <class ShapeVec>
+int const core_shape_ids<ShapeVec, 0>::value[1] = { 0 };
+
+#define BOOST_PP_ITERATION_PARAMS_1                                            \
+    (4, (1, BOOST_NUMPY_LIMIT_CORE_SHAPE_ND, <boost/numpy/dstream/mapping/detail/core_shape.hpp>, 4))
+#include BOOST_PP_ITERATE()
+
 // The shape_vec_t type is a boost::mpl::vector of boost::mpl::int_ types,
 // specifying the shape of the core dimensions of the ndarray.
 // By convention, positive values specify fixed length
@@ -106,7 +131,33 @@ struct core_shape_base
     int
     id(int idx)
     {
-        return as_std_vector()[idx];
+        return core_shape_ids<shape_vec_t, nd::value>::value[idx];
+    }
+
+    //__________________________________________________________________________
+    /**
+     * \brief Evaluates to the idx'th id of the core shape description MPL
+     *     vector at compile time.
+     */
+    template <unsigned idx>
+    struct dim_id
+      : boost::mpl::at_c<shape_vec_t, idx>::type
+    {};
+
+    //__________________________________________________________________________
+    /**
+     * \brief Returns the length of the idx'th core dimension. For a fixed
+     *     sized core dimension this is a compile-time constant, which allows
+     *     the compiler to unroll loops over this dimension. Otherwise, the
+     *     length is taken from the given actual core shape.
+     */
+    template <unsigned idx>
+    inline
+    static
+    intptr_t
+    dim_len(std::vector<intptr_t> const & core_shape)
+    {
+        return (dim_id<idx>::value > 0 ? intptr_t(dim_id<idx>::value) : core_shape[idx]);
     }
 };
 
@@ -335,6 +386,22 @@ operator,(CoreShapeTuple const &, CoreShape const &)
     return typename make_core_shape_tuple<N>::impl<CoreShapeTuple,CoreShape>::type();
 }
 
+#else
+#if BOOST_PP_ITERATION_FLAGS() == 4
+
+template <class ShapeVec>
+struct core_shape_ids<ShapeVec, N>
+{
+    static int const value[N];
+};
+
+#define BOOST_NUMPY_DEF(z, n, data) \
+    boost::mpl::at_c<ShapeVec, n>::type::value
+template <class ShapeVec>
+int const core_shape_ids<ShapeVec, N>::value[N] = { BOOST_PP_ENUM(N, BOOST_NUMPY_DEF, ~) };
+#undef BOOST_NUMPY_DEF
+
+#endif // BOOST_PP_ITERATION_FLAGS() == 4
 #endif // BOOST_PP_ITERATION_FLAGS() == 3
 #endif // BOOST_PP_ITERATION_FLAGS() == 2
 #endif // BOOST_PP_ITERATION_FLAGS() == 1
@@ -0,0 +1,279 @@
+/**
+ * $Id$
+ *
+ * Copyright (C)
+ * 2014 - $Date$
+ *     Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \file    boost/numpy/dstream/packed_bool.hpp
+ * \version $Revision$
+ * \date    $Date$
+ * \author  Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \brief This file defines the boost::numpy::dstream::packed_bool element
+ *        type and the one-dimensional array_view specializations for it. A
+ *        packed_bool array is a uint8 array holding eight boolean values per
+ *        byte in the layout of numpy.packbits, i.e. the first value is the
+ *        most significant bit of the first byte. The views unpack and pack
+ *        the individual bits on access, so functions see bool values.
+ *
+ *        This file is distributed under the Boost Software License,
+ *        Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ *        http://www.boost.org/LICENSE_1_0.txt).
+ */
+#ifndef BOOST_NUMPY_DSTREAM_PACKED_BOOL_HPP_INCLUDED
+#define BOOST_NUMPY_DSTREAM_PACKED_BOOL_HPP_INCLUDED
+
+#include <stdint.h>
+
+#include <cstddef>
+
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+
+#include <boost/numpy/dtype.hpp>
+#include <boost/numpy/dstream/array_view.hpp>
+
+namespace boost {
+namespace numpy {
+namespace dstream {
+
+/**
+ * The packed_bool type is the element type of an array with bit-packed
+ * boolean values. It can only be used as value type of a one-dimensional
+ * array_view.
+ */
+struct packed_bool
+{
+    uint8_t bits;
+};
+
+template <class T>
+struct is_packed_bool
+  : boost::mpl::false_
+{};
+
+template <>
+struct is_packed_bool<packed_bool>
+  : boost::mpl::true_
+{};
+
+template <>
+struct is_packed_bool<packed_bool const>
+  : boost::mpl::true_
+{};
+
+/**
+ * The packed_bool_reference class refers to a single bit of a bit-packed
+ * boolean array. It is returned by the element access operators of a mutable
+ * packed_bool array_view.
+ */
+class packed_bool_reference
+{
+  public:
+    packed_bool_reference(uint8_t & byte, uint8_t mask)
+      : byte_(byte)
+      , mask_(mask)
+    {}
+
+    inline
+    operator bool() const
+    {
+        return (byte_ & mask_) != 0;
+    }
+
+    inline
+    packed_bool_reference &
+    operator=(bool value)
+    {
+        if(value)
+            byte_ |= mask_;
+        else
+            byte_ &= uint8_t(~mask_);
+        return *this;
+    }
+
+    inline
+    packed_bool_reference &
+    operator=(packed_bool_reference const & ref)
+    {
+        return operator=(bool(ref));
+    }
+
+  protected:
+    uint8_t & byte_;
+    uint8_t   mask_;
+};
+
+namespace detail {
+
+class packed_bool_array_view_base
+{
+  public:
+    BOOST_STATIC_CONSTANT(unsigned, ndim = 1);
+
+    packed_bool_array_view_base()
+      : data_(NULL)
+      , nbytes_(0)
+      , stride_(0)
+    {}
+
+    packed_bool_array_view_base(char * data, intptr_t const * shape, intptr_t const * strides)
+      : data_(data)
+      , nbytes_(shape[0])
+      , stride_(strides[0])
+    {}
+
+    /**
+     * \brief Returns the number of boolean values of the view, i.e. eight
+     *     times the number of bytes of the core dimension. Padding bits at
+     *     the end of the last byte are included.
+     */
+    inline
+    intptr_t
+    size(unsigned) const
+    {
+        return 8*nbytes_;
+    }
+
+    /**
+     * \brief Returns the stride in bytes between two bytes of the view.
+     */
+    inline
+    intptr_t
+    stride(unsigned) const
+    {
+        return stride_;
+    }
+
+    inline
+    char *
+    data() const
+    {
+        return data_;
+    }
+
+    inline
+    void
+    set_data(char * data)
+    {
+        data_ = data;
+    }
+
+  protected:
+    inline
+    uint8_t &
+    byte(intptr_t i) const
+    {
+        return *reinterpret_cast<uint8_t *>(data_ + (i >> 3)*stride_);
+    }
+
+    static
+    uint8_t
+    mask(intptr_t i)
+    {
+        return uint8_t(0x80u >> (i & 7));
+    }
+
+    char *   data_;
+    intptr_t nbytes_;
+    intptr_t stride_;
+};
+
+}// namespace detail
+
+/**
+ * The read-only view of a bit-packed boolean core dimension.
+ */
+template <>
+class array_view<packed_bool const, 1>
+  : public detail::packed_bool_array_view_base
+{
+  public:
+    typedef packed_bool const
+            value_type;
+    typedef bool
+            reference;
+    typedef bool
+            subscript_t;
+
+    array_view()
+    {}
+
+    array_view(char * data, intptr_t const * shape, intptr_t const * strides)
+      : detail::packed_bool_array_view_base(data, shape, strides)
+    {}
+
+    inline
+    bool
+    operator[](intptr_t i) const
+    {
+        return (byte(i) & mask(i)) != 0;
+    }
+
+    inline
+    bool
+    operator()(intptr_t i) const
+    {
+        return (*this)[i];
+    }
+};
+
+/**
+ * The mutable view of a bit-packed boolean core dimension. Assigning to an
+ * element sets or clears the single bit of the element.
+ */
+template <>
+class array_view<packed_bool, 1>
+  : public detail::packed_bool_array_view_base
+{
+  public:
+    typedef packed_bool
+            value_type;
+    typedef packed_bool_reference
+            reference;
+    typedef packed_bool_reference
+            subscript_t;
+
+    array_view()
+    {}
+
+    array_view(char * data, intptr_t const * shape, intptr_t const * strides)
+      : detail::packed_bool_array_view_base(data, shape, strides)
+    {}
+
+    inline
+    packed_bool_reference
+    operator[](intptr_t i) const
+    {
+        return packed_bool_reference(byte(i), mask(i));
+    }
+
+    inline
+    packed_bool_reference
+    operator()(intptr_t i) const
+    {
+        return (*this)[i];
+    }
+};
+
+}// namespace dstream
+
+namespace detail {
+
+// The array data type of bit-packed booleans is uint8.
+template <>
+struct builtin_dtype<dstream::packed_bool, false>
+{
+    static dtype get()
+    {
+        return dtype::get_builtin<uint8_t>();
+    }
+};
+
+}// namespace detail
+
+}// namespace numpy
+}// namespace boost
+
+#endif // !BOOST_NUMPY_DSTREAM_PACKED_BOOL_HPP_INCLUDED
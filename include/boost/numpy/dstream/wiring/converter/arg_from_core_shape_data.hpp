@@ -24,20 +24,31 @@
 #ifndef BOOST_NUMPY_DSTREAM_WIRING_ARG_FROM_CORE_SHAPE_DATA_HPP_INCLUDED
 #define BOOST_NUMPY_DSTREAM_WIRING_ARG_FROM_CORE_SHAPE_DATA_HPP_INCLUDED
 
+#include <algorithm>
 #include <vector>
 
+#include <boost/preprocessor/arithmetic/inc.hpp>
 #include <boost/preprocessor/arithmetic/sub.hpp>
+#include <boost/preprocessor/cat.hpp>
 #include <boost/preprocessor/iterate.hpp>
 #include <boost/preprocessor/repetition/repeat.hpp>
 #include <boost/preprocessor/stringize.hpp>
 
 #include <boost/mpl/and.hpp>
 #include <boost/mpl/assert.hpp>
+#include <boost/mpl/bool.hpp>
 #include <boost/mpl/if.hpp>
+#include <boost/mpl/or.hpp>
 #include <boost/type_traits/is_scalar.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <boost/type_traits/remove_cv.hpp>
 #include <boost/type_traits/remove_reference.hpp>
 
+#include <boost/numpy/mpl/is_fixed_size_array.hpp>
+#include <boost/numpy/mpl/is_scalar.hpp>
 #include <boost/numpy/mpl/is_std_vector.hpp>
+#include <boost/numpy/dstream/array_view.hpp>
+#include <boost/numpy/dstream/packed_bool.hpp>
 #include <boost/numpy/dstream/wiring/detail/iter_data_ptr.hpp>
 
 namespace boost {
@@ -162,10 +173,10 @@ struct scalar_arg_from_core_shape_data
 
 //------------------------------------------------------------------------------
 
-template <class FctArgT, class ScalarT, class ArrDataHoldingT, unsigned nd>
+template <class FctArgT, class ScalarT, class CoreShape, class ArrDataHoldingT, unsigned nd>
 struct std_vector_of_scalar_arg_from_scalar_core_shape_data;
 
-template <class ArgT, unsigned nd>
+template <class ArgT, class CoreShape, unsigned nd>
 struct std_vector_of_bp_object_arg_from_bp_object_core_shape_data;
 
 // Define nd specializations for dimensions J to Z, i.e. up to 18 dimensions.
@@ -179,7 +190,7 @@ struct std_vector_of_scalar_arg_from_core_shape_data
     typedef typename mapping::detail::is_core_shape_of_dim<CoreShape, nd>::type
             is_core_shape_of_dim_nd;
 
-    typedef typename is_scalar<ArrDataHoldingT>::type
+    typedef typename numpy::mpl::is_scalar<ArrDataHoldingT>::type
             is_scalar_arr_data_holding_type;
 
     typedef typename boost::mpl::eval_if<
@@ -187,7 +198,7 @@ struct std_vector_of_scalar_arg_from_core_shape_data
                 is_core_shape_of_dim_nd
               , is_scalar_arr_data_holding_type
               >::type
-            , std_vector_of_scalar_arg_from_scalar_core_shape_data<FctArgT, ScalarT, ArrDataHoldingT, nd>
+            , std_vector_of_scalar_arg_from_scalar_core_shape_data<FctArgT, ScalarT, CoreShape, ArrDataHoldingT, nd>
 
             , numpy::mpl::unspecified
             >::type
@@ -208,7 +219,7 @@ struct std_vector_of_bp_object_arg_from_core_shape_data
                 is_core_shape_of_dim_nd
               , is_bp_object_arr_data_holding_type
               >::type
-            , std_vector_of_bp_object_arg_from_bp_object_core_shape_data<ArgT, nd>
+            , std_vector_of_bp_object_arg_from_bp_object_core_shape_data<ArgT, CoreShape, nd>
 
             , numpy::mpl::unspecified
             >::type
@@ -228,7 +239,7 @@ struct std_vector_arg_from_core_shape_data
             vector_bare_value_t;
 
     typedef typename boost::mpl::if_<
-              typename is_scalar<vector_bare_value_t>::type
+              typename numpy::mpl::is_scalar<vector_bare_value_t>::type
             , std_vector_of_scalar_arg_from_core_shape_data<ArgT, vector_value_t, CoreShape, ArrDataHoldingT, nd>
 
             , typename boost::mpl::if_<
@@ -248,6 +259,248 @@ struct std_vector_arg_from_core_shape_data
 
 //------------------------------------------------------------------------------
 
+template <class FctArgT>
+struct array_view_arg_from_scalar_core_shape_data
+{
+    typedef array_view_arg_from_scalar_core_shape_data<FctArgT>
+            type;
+
+    typedef FctArgT
+            arg_t;
+    typedef typename remove_const<typename remove_reference<arg_t>::type>::type
+            view_t;
+
+    array_view_arg_from_scalar_core_shape_data(
+        numpy::detail::iter &         iter
+      , size_t const                  iter_op_idx
+      , std::vector<intptr_t> const & core_shape
+    )
+      : iter_(iter)
+      , iter_op_idx_(iter_op_idx)
+    {
+        // Get the strides of the argument ndarray. Note: This contains the
+        // strides for all dimensions, i.e. also for the loop dimensions.
+        // The strides for the core dimensions are the last entries in this
+        // vector.
+        std::vector<intptr_t> const strides = iter_.get_operand(iter_op_idx_).get_strides_vector();
+        view_ = view_t(NULL, &core_shape[0], &strides[strides.size() - view_t::ndim]);
+    }
+
+    inline
+    arg_t
+    operator()()
+    {
+        // Only the data pointer changes from one loop element to the next,
+        // so the view just needs to be moved to the current element.
+        view_.set_data(iter_.get_data(iter_op_idx_));
+        return view_;
+    }
+
+    numpy::detail::iter & iter_;
+    size_t const          iter_op_idx_;
+    view_t                view_;
+};
+
+template <class FctArgT, class CoreShape, class ArrDataHoldingT>
+struct array_view_arg_from_core_shape_data
+{
+    typedef typename remove_const<typename remove_reference<FctArgT>::type>::type
+            view_t;
+
+    typedef typename mapping::detail::is_core_shape_of_dim<CoreShape, view_t::ndim>::type
+            is_core_shape_of_dim_nd;
+
+    // Bit-packed booleans are stored as uint8 scalars.
+    typedef typename boost::mpl::or_<
+              typename numpy::mpl::is_scalar<ArrDataHoldingT>::type
+            , typename dstream::is_packed_bool<ArrDataHoldingT>::type
+            >::type
+            is_scalar_arr_data_holding_type;
+
+    typedef typename boost::mpl::eval_if<
+              typename boost::mpl::and_<
+                is_core_shape_of_dim_nd
+              , is_scalar_arr_data_holding_type
+              >::type
+            , array_view_arg_from_scalar_core_shape_data<FctArgT>
+
+            , numpy::mpl::unspecified
+            >::type
+            type;
+};
+
+//------------------------------------------------------------------------------
+// The fixed_size_array_arg_from_scalar_core_shape_data template constructs a
+// one- or two-dimensional fixed-size array argument (i.e. a boost::array or a
+// std::array) from the core dimensions of an operand. The lengths of the core
+// dimensions are compile-time constants, so the loops over them can be
+// unrolled by the compiler.
+template <class FctArgT, class ArrDataHoldingT, unsigned nd>
+struct fixed_size_array_arg_from_scalar_core_shape_data;
+
+template <class FctArgT, class ArrDataHoldingT>
+struct fixed_size_array_arg_from_scalar_core_shape_data<FctArgT, ArrDataHoldingT, 1>
+{
+    typedef fixed_size_array_arg_from_scalar_core_shape_data<FctArgT, ArrDataHoldingT, 1>
+            type;
+
+    typedef FctArgT
+            arg_t;
+    typedef typename remove_cv<typename remove_reference<arg_t>::type>::type
+            array_t;
+    typedef typename array_t::value_type
+            array_value_t;
+
+    BOOST_STATIC_CONSTANT(intptr_t, N = numpy::mpl::fixed_size_array_size<array_t>::value);
+
+    fixed_size_array_arg_from_scalar_core_shape_data(
+        numpy::detail::iter &         iter
+      , size_t const                  iter_op_idx
+      , std::vector<intptr_t> const & //core_shape
+    )
+      : iter_(iter)
+      , iter_op_idx_(iter_op_idx)
+      , stride_(iter_.get_operand(iter_op_idx_).get_strides_vector().back())
+      , arg_data_ptr_(NULL)
+      , arg_()
+    {}
+
+    inline
+    arg_t
+    operator()()
+    {
+        char * const data_ptr = iter_.get_data(iter_op_idx_);
+        if(data_ptr != arg_data_ptr_)
+        {
+            for(intptr_t i=0; i<N; ++i)
+            {
+                arg_[i] = array_value_t(*reinterpret_cast<ArrDataHoldingT *>(data_ptr + i*stride_));
+            }
+            arg_data_ptr_ = data_ptr;
+        }
+
+        return arg_;
+    }
+
+    numpy::detail::iter & iter_;
+    size_t const          iter_op_idx_;
+    intptr_t const        stride_;
+    char *                arg_data_ptr_;
+    array_t               arg_;
+};
+
+template <class FctArgT, class ArrDataHoldingT>
+struct fixed_size_array_arg_from_scalar_core_shape_data<FctArgT, ArrDataHoldingT, 2>
+{
+    typedef fixed_size_array_arg_from_scalar_core_shape_data<FctArgT, ArrDataHoldingT, 2>
+            type;
+
+    typedef FctArgT
+            arg_t;
+    typedef typename remove_cv<typename remove_reference<arg_t>::type>::type
+            array_t;
+    typedef typename array_t::value_type
+            row_t;
+    typedef typename row_t::value_type
+            array_value_t;
+
+    BOOST_STATIC_CONSTANT(intptr_t, N = numpy::mpl::fixed_size_array_size<array_t>::value);
+    BOOST_STATIC_CONSTANT(intptr_t, M = numpy::mpl::fixed_size_array_size<row_t>::value);
+
+    fixed_size_array_arg_from_scalar_core_shape_data(
+        numpy::detail::iter &         iter
+      , size_t const                  iter_op_idx
+      , std::vector<intptr_t> const & //core_shape
+    )
+      : iter_(iter)
+      , iter_op_idx_(iter_op_idx)
+      , strides_(iter_.get_operand(iter_op_idx_).get_strides_vector())
+      , stride0_(strides_[strides_.size()-2])
+      , stride1_(strides_[strides_.size()-1])
+      , arg_data_ptr_(NULL)
+      , arg_()
+    {}
+
+    inline
+    arg_t
+    operator()()
+    {
+        char * const data_ptr = iter_.get_data(iter_op_idx_);
+        if(data_ptr != arg_data_ptr_)
+        {
+            for(intptr_t i=0; i<N; ++i)
+            {
+                for(intptr_t j=0; j<M; ++j)
+                {
+                    arg_[i][j] = array_value_t(*reinterpret_cast<ArrDataHoldingT *>(data_ptr + i*stride0_ + j*stride1_));
+                }
+            }
+            arg_data_ptr_ = data_ptr;
+        }
+
+        return arg_;
+    }
+
+    numpy::detail::iter &       iter_;
+    size_t const                iter_op_idx_;
+    std::vector<intptr_t> const strides_;
+    intptr_t const              stride0_;
+    intptr_t const              stride1_;
+    char *                      arg_data_ptr_;
+    array_t                     arg_;
+};
+
+template <class CoreShape, class ArrayT, unsigned nd>
+struct core_shape_has_fixed_size_array_lengths;
+
+template <class CoreShape, class ArrayT>
+struct core_shape_has_fixed_size_array_lengths<CoreShape, ArrayT, 1>
+  : boost::mpl::bool_< CoreShape::template dim_id<0>::value == numpy::mpl::fixed_size_array_size<ArrayT>::value >
+{};
+
+template <class CoreShape, class ArrayT>
+struct core_shape_has_fixed_size_array_lengths<CoreShape, ArrayT, 2>
+  : boost::mpl::bool_<
+        CoreShape::template dim_id<0>::value == numpy::mpl::fixed_size_array_size<ArrayT>::value
+     && CoreShape::template dim_id<1>::value == numpy::mpl::fixed_size_array_size<typename remove_cv<typename ArrayT::value_type>::type>::value
+    >
+{};
+
+template <class FctArgT, class CoreShape, class ArrDataHoldingT>
+struct fixed_size_array_arg_from_core_shape_data
+{
+    typedef typename remove_cv<typename remove_reference<FctArgT>::type>::type
+            array_t;
+    typedef typename remove_cv<typename array_t::value_type>::type
+            array_value_t;
+
+    BOOST_STATIC_CONSTANT(unsigned, nd = (numpy::mpl::is_fixed_size_array<array_value_t>::value ? 2 : 1));
+
+    // The core shape must have the fixed lengths of the fixed-size array,
+    // which is the case for the core shape deduced from the argument type.
+    typedef typename boost::mpl::and_<
+              typename mapping::detail::is_core_shape_of_dim<CoreShape, nd>::type
+            , core_shape_has_fixed_size_array_lengths<CoreShape, array_t, nd>
+            >::type
+            is_matching_core_shape;
+
+    typedef typename numpy::mpl::is_scalar<ArrDataHoldingT>::type
+            is_scalar_arr_data_holding_type;
+
+    typedef typename boost::mpl::eval_if<
+              typename boost::mpl::and_<
+                is_matching_core_shape
+              , is_scalar_arr_data_holding_type
+              >::type
+            , fixed_size_array_arg_from_scalar_core_shape_data<FctArgT, ArrDataHoldingT, nd>
+
+            , numpy::mpl::unspecified
+            >::type
+            type;
+};
+
+//------------------------------------------------------------------------------
+
 template <class FctArgT, class CoreShape, class ArrDataHoldingT>
 struct select_arg_from_core_shape_data_converter
 {
@@ -259,14 +512,24 @@ struct select_arg_from_core_shape_data_converter
             , bp_object_arg_from_core_shape_data<FctArgT, CoreShape, ArrDataHoldingT>
 
             , typename boost::mpl::if_<
-                typename is_scalar<bare_arg_t>::type
+                typename numpy::mpl::is_scalar<bare_arg_t>::type
               , scalar_arg_from_core_shape_data<FctArgT, CoreShape, ArrDataHoldingT>
 
               , typename boost::mpl::eval_if<
-                  typename numpy::mpl::is_std_vector<bare_arg_t>::type
+                  typename numpy::mpl::is_std_vector<typename remove_cv<bare_arg_t>::type>::type
                 , std_vector_arg_from_core_shape_data<FctArgT, FctArgT, CoreShape, ArrDataHoldingT, 1>
 
-                , numpy::mpl::unspecified
+                , typename boost::mpl::eval_if<
+                    typename dstream::is_array_view<bare_arg_t>::type
+                  , array_view_arg_from_core_shape_data<FctArgT, CoreShape, ArrDataHoldingT>
+
+                  , typename boost::mpl::eval_if<
+                      typename numpy::mpl::is_fixed_size_array<typename remove_cv<bare_arg_t>::type>::type
+                    , fixed_size_array_arg_from_core_shape_data<FctArgT, CoreShape, ArrDataHoldingT>
+
+                    , numpy::mpl::unspecified
+                    >::type
+                  >::type
                 >::type
               >::type
             >::type
@@ -303,22 +566,41 @@ struct arg_from_core_shape_data_converter
 #define BOOST_NUMPY_DSTREAM_vec_def_p1(z, n, data) std::vector<
 #define BOOST_NUMPY_DSTREAM_vec_def_p2(z, n, data) >
 
+// Loops over the core dimension n and binds the reference v<n+1> to the
+// (nested) vector at the current index of the vector v<n>.
 #define BOOST_NUMPY_DSTREAM_for_dim_begin(z, n, nd) \
+    for(dim_indices_[n]=0; dim_indices_[n] < CoreShape::template dim_len<n>(core_shape_); ++dim_indices_[n]) { \
+    BOOST_PP_REPEAT(BOOST_PP_SUB(BOOST_PP_SUB(nd,n),1), BOOST_NUMPY_DSTREAM_vec_def_p1, ~) \
+    ScalarT \
+    BOOST_PP_REPEAT(BOOST_PP_SUB(BOOST_PP_SUB(nd,n),1), BOOST_NUMPY_DSTREAM_vec_def_p2, ~) \
+    & BOOST_PP_CAT(v,BOOST_PP_INC(n)) = BOOST_PP_CAT(v,n)[dim_indices_[n]];
+
+// Same as BOOST_NUMPY_DSTREAM_for_dim_begin, but resizes the vector v<n> to
+// the length of the core dimension n first.
+#define BOOST_NUMPY_DSTREAM_resize_dim_begin(z, n, nd) \
+    BOOST_PP_CAT(v,n).resize(CoreShape::template dim_len<n>(core_shape_)); \
+    BOOST_NUMPY_DSTREAM_for_dim_begin(z, n, nd)
+
+#define BOOST_NUMPY_DSTREAM_for_dim_end(z, n, nd) }
+
+// Declares a new (nested) vector v<n> and loops over the core dimension n.
+// The vector v<n+1> is appended to v<n> by BOOST_NUMPY_DSTREAM_push_dim_end.
+#define BOOST_NUMPY_DSTREAM_push_dim_begin(z, n, nd) \
     BOOST_PP_REPEAT(BOOST_PP_SUB(nd,n), BOOST_NUMPY_DSTREAM_vec_def_p1, ~) \
     ScalarT \
     BOOST_PP_REPEAT(BOOST_PP_SUB(nd,n), BOOST_NUMPY_DSTREAM_vec_def_p2, ~) \
     BOOST_PP_CAT(v,n); \
-    BOOST_PP_CAT(v,n).reserve(core_shape_[n]); \
-    for(dim_indices_[n]=0; dim_indices_[n] < core_shape_[n]; ++dim_indices_[n]) {
+    BOOST_PP_CAT(v,n).reserve(CoreShape::template dim_len<n>(core_shape_)); \
+    for(dim_indices_[n]=0; dim_indices_[n] < CoreShape::template dim_len<n>(core_shape_); ++dim_indices_[n]) {
 
-#define BOOST_NUMPY_DSTREAM_for_dim_end(z, n, nd) \
+#define BOOST_NUMPY_DSTREAM_push_dim_end(z, n, nd) \
     BOOST_PP_CAT(v, BOOST_PP_SUB(BOOST_PP_SUB(nd,n),1)).push_back( \
         BOOST_PP_CAT(v,BOOST_PP_SUB(nd,n))); }
 
-template <class FctArgT, class ScalarT, class ArrDataHoldingT>
-struct std_vector_of_scalar_arg_from_scalar_core_shape_data<FctArgT, ScalarT, ArrDataHoldingT, ND>
+template <class FctArgT, class ScalarT, class CoreShape, class ArrDataHoldingT>
+struct std_vector_of_scalar_arg_from_scalar_core_shape_data<FctArgT, ScalarT, CoreShape, ArrDataHoldingT, ND>
 {
-    typedef std_vector_of_scalar_arg_from_scalar_core_shape_data<FctArgT, ScalarT, ArrDataHoldingT, ND>
+    typedef std_vector_of_scalar_arg_from_scalar_core_shape_data<FctArgT, ScalarT, CoreShape, ArrDataHoldingT, ND>
             type;
 
     typedef FctArgT
@@ -339,17 +621,60 @@ struct std_vector_of_scalar_arg_from_scalar_core_shape_data<FctArgT, ScalarT, Ar
       , strides_(iter_.get_operand(iter_op_idx_).get_strides_vector())
       , dim_indices_(std::vector<intptr_t>(ND))
       , iter_data_ptr_(wiring::detail::iter_data_ptr<ND, 0>(iter_, iter_op_idx_, dim_indices_, strides_))
-    {}
+      , arg_data_ptr_(NULL)
+        // The elements of the last core dimension are contiguous in memory,
+        // if its stride equals the size of the array data holding type.
+      , is_inner_contiguous_(CoreShape::template dim_len<ND-1>(core_shape_) <= 1 || strides_.back() == intptr_t(sizeof(ArrDataHoldingT)))
+    {
+        // Size the (nested) argument vector to the core shape once. The loop
+        // elements are written into this storage in place, so no memory is
+        // allocated after construction.
+        BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_vec_def_p1, ~)
+        ScalarT
+        BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_vec_def_p2, ~)
+        & v0 = arg_;
+        BOOST_PP_REPEAT(BOOST_PP_SUB(ND,1), BOOST_NUMPY_DSTREAM_resize_dim_begin, ND)
+        BOOST_PP_CAT(v,BOOST_PP_SUB(ND,1)).resize(CoreShape::template dim_len<ND-1>(core_shape_));
+        BOOST_PP_REPEAT(BOOST_PP_SUB(ND,1), BOOST_NUMPY_DSTREAM_for_dim_end, ND)
+    }
 
     inline
     arg_t
     operator()()
     {
-        BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_for_dim_begin, ND)
-        ArrDataHoldingT & BOOST_PP_CAT(v,ND) = *reinterpret_cast<ArrDataHoldingT *>(iter_data_ptr_());
-        BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_for_dim_end, ND)
-
-        return v0;
+        // Fill the argument only if the data pointer of the operand has
+        // moved since the last call. For an operand, which is broadcast over
+        // the loop dimensions (i.e. has a zero loop stride), the argument is
+        // filled only once.
+        char * const data_ptr = iter_.get_data(iter_op_idx_);
+        if(data_ptr != arg_data_ptr_)
+        {
+            BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_vec_def_p1, ~)
+            ScalarT
+            BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_vec_def_p2, ~)
+            & v0 = arg_;
+            BOOST_PP_REPEAT(BOOST_PP_SUB(ND,1), BOOST_NUMPY_DSTREAM_for_dim_begin, ND)
+            if(is_inner_contiguous_)
+            {
+                // Copy the entire last core dimension at once from the
+                // contiguous array data.
+                dim_indices_[ND-1] = 0;
+                ArrDataHoldingT const * const first = reinterpret_cast<ArrDataHoldingT const *>(iter_data_ptr_());
+                std::copy(first, first + CoreShape::template dim_len<ND-1>(core_shape_), BOOST_PP_CAT(v,BOOST_PP_SUB(ND,1)).begin());
+            }
+            else
+            {
+                for(dim_indices_[ND-1]=0; dim_indices_[ND-1] < CoreShape::template dim_len<ND-1>(core_shape_); ++dim_indices_[ND-1])
+                {
+                    BOOST_PP_CAT(v,BOOST_PP_SUB(ND,1))[dim_indices_[ND-1]] = *reinterpret_cast<ArrDataHoldingT *>(iter_data_ptr_());
+                }
+            }
+            BOOST_PP_REPEAT(BOOST_PP_SUB(ND,1), BOOST_NUMPY_DSTREAM_for_dim_end, ND)
+
+            arg_data_ptr_ = data_ptr;
+        }
+
+        return arg_;
     }
 
     numpy::detail::iter &                iter_;
@@ -358,12 +683,18 @@ struct std_vector_of_scalar_arg_from_scalar_core_shape_data<FctArgT, ScalarT, Ar
     std::vector<intptr_t> const          strides_;
     std::vector<intptr_t>                dim_indices_;
     wiring::detail::iter_data_ptr<ND, 0> iter_data_ptr_;
+    char *                               arg_data_ptr_;
+    bool const                           is_inner_contiguous_;
+    BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_vec_def_p1, ~)
+    ScalarT
+    BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_vec_def_p2, ~)
+                                         arg_;
 };
 
-template <class ArgT>
-struct std_vector_of_bp_object_arg_from_bp_object_core_shape_data<ArgT, ND>
+template <class ArgT, class CoreShape>
+struct std_vector_of_bp_object_arg_from_bp_object_core_shape_data<ArgT, CoreShape, ND>
 {
-    typedef std_vector_of_bp_object_arg_from_bp_object_core_shape_data<ArgT, ND>
+    typedef std_vector_of_bp_object_arg_from_bp_object_core_shape_data<ArgT, CoreShape, ND>
             type;
 
     typedef ArgT
@@ -393,10 +724,10 @@ struct std_vector_of_bp_object_arg_from_bp_object_core_shape_data<ArgT, ND>
     arg_t
     operator()()
     {
-        BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_for_dim_begin, ND)
+        BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_push_dim_begin, ND)
         uintptr_t * data = reinterpret_cast<uintptr_t*>(iter_data_ptr_());
         boost::python::object BOOST_PP_CAT(v,ND)(boost::python::detail::borrowed_reference(reinterpret_cast<PyObject*>(*data)));
-        BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_for_dim_end, ND)
+        BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_push_dim_end, ND)
 
         return v0;
     }
@@ -409,6 +740,9 @@ struct std_vector_of_bp_object_arg_from_bp_object_core_shape_data<ArgT, ND>
     wiring::detail::iter_data_ptr<ND, 0> iter_data_ptr_;
 };
 
+#undef BOOST_NUMPY_DSTREAM_push_dim_end
+#undef BOOST_NUMPY_DSTREAM_push_dim_begin
+#undef BOOST_NUMPY_DSTREAM_resize_dim_begin
 #undef BOOST_NUMPY_DSTREAM_for_dim_end
 #undef BOOST_NUMPY_DSTREAM_for_dim_begin
 #undef BOOST_NUMPY_DSTREAM_vec_def_p2
@@ -23,10 +23,17 @@
 #define BOOST_NUMPY_DSTREAM_WIRING_ARG_TYPE_TO_ARRAY_DTYPE_HPP_INCLUDED
 
 #include <boost/mpl/assert.hpp>
+#include <boost/mpl/eval_if.hpp>
 #include <boost/mpl/if.hpp>
 #include <boost/type_traits/is_scalar.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <boost/type_traits/remove_cv.hpp>
 #include <boost/type_traits/remove_reference.hpp>
 
+#include <boost/numpy/mpl/is_fixed_size_array.hpp>
+#include <boost/numpy/mpl/is_scalar.hpp>
+#include <boost/numpy/dstream/array_view.hpp>
+
 namespace boost {
 namespace numpy {
 namespace dstream {
@@ -58,7 +65,7 @@ struct std_vector_arg_type_to_array_dtype
             vector_bare_value_t;
 
     typedef typename boost::mpl::if_<
-              typename is_scalar<vector_bare_value_t>::type
+              typename numpy::mpl::is_scalar<vector_bare_value_t>::type
             , vector_bare_value_t
 
             , typename boost::mpl::if_<
@@ -76,6 +83,39 @@ struct std_vector_arg_type_to_array_dtype
             type;
 };
 
+template <class T>
+struct array_view_arg_type_to_array_dtype
+{
+    typedef typename remove_reference<T>::type
+            view_t;
+    typedef typename remove_const<typename view_t::value_type>::type
+            type;
+};
+
+// The array data type of a (possibly two-dimensional) fixed-size array is its
+// scalar value type.
+template <class T>
+struct fixed_size_array_arg_type_to_array_dtype
+{
+    typedef typename remove_cv<typename remove_reference<T>::type>::type
+            array_t;
+    typedef typename remove_cv<typename array_t::value_type>::type
+            array_bare_value_t;
+
+    typedef typename boost::mpl::if_<
+              typename numpy::mpl::is_scalar<array_bare_value_t>::type
+            , array_bare_value_t
+
+            , typename boost::mpl::eval_if<
+                typename numpy::mpl::is_fixed_size_array<array_bare_value_t>::type
+              , fixed_size_array_arg_type_to_array_dtype<array_bare_value_t>
+
+              , numpy::mpl::unspecified
+              >::type
+            >::type
+            type;
+};
+
 template <class T>
 struct select_arg_type_to_array_dtype
 {
@@ -83,7 +123,7 @@ struct select_arg_type_to_array_dtype
             bare_t;
 
     typedef typename boost::mpl::if_<
-              typename is_scalar<bare_t>::type
+              typename numpy::mpl::is_scalar<bare_t>::type
             , boost::mpl::identity<bare_t>
 
             , typename boost::mpl::if_<
@@ -91,10 +131,20 @@ struct select_arg_type_to_array_dtype
               , boost::mpl::identity<python::object>
 
               , typename boost::mpl::if_<
-                  typename numpy::mpl::is_std_vector<bare_t>::type
+                  typename numpy::mpl::is_std_vector<typename remove_cv<bare_t>::type>::type
                 , std_vector_arg_type_to_array_dtype<T>
 
-                , numpy::mpl::unspecified
+                , typename boost::mpl::if_<
+                    typename dstream::is_array_view<bare_t>::type
+                  , array_view_arg_type_to_array_dtype<T>
+
+                  , typename boost::mpl::if_<
+                      typename numpy::mpl::is_fixed_size_array<typename remove_cv<bare_t>::type>::type
+                    , fixed_size_array_arg_type_to_array_dtype<T>
+
+                    , numpy::mpl::unspecified
+                    >::type
+                  >::type
                 >::type
               >::type
             >::type
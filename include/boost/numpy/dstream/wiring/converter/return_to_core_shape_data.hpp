@@ -25,6 +25,7 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
@@ -42,12 +43,19 @@
 #include <boost/assert.hpp>
 #include <boost/mpl/and.hpp>
 #include <boost/mpl/assert.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/eval_if.hpp>
 #include <boost/mpl/if.hpp>
+#include <boost/mpl/int.hpp>
 #include <boost/python/refcount.hpp>
 #include <boost/type_traits/is_scalar.hpp>
+#include <boost/type_traits/remove_cv.hpp>
 #include <boost/type_traits/remove_reference.hpp>
 
 #include <boost/numpy/limits.hpp>
+#include <boost/numpy/mpl/is_fixed_size_array.hpp>
+#include <boost/numpy/mpl/is_scalar.hpp>
+#include <boost/numpy/mpl/is_tuple.hpp>
 #include <boost/numpy/detail/iter.hpp>
 #include <boost/numpy/detail/utils.hpp>
 #include <boost/numpy/dstream/mapping/detail/definition.hpp>
@@ -136,7 +144,7 @@ struct select_scalar_return_to_core_shape_data_impl
             is_scalar_out_array;
 
     // Check if the output array has a scalar data holding type.
-    typedef typename is_scalar<typename WiringModelAPI::template out_arr_value_type<0>::type>::type
+    typedef typename numpy::mpl::is_scalar<typename WiringModelAPI::template out_arr_value_type<0>::type>::type
             is_scalar_out_array_data_type;
 
     typedef typename boost::mpl::if_<
@@ -256,7 +264,7 @@ struct select_std_vector_of_scalar_return_to_core_shape_data_impl
 
     // Second, we need to check if all the output arrays have a scalar data
     // holding type.
-    typedef typename wiring::detail::utilities<WiringModelAPI>::template all_out_arr_value_types<boost::is_scalar>::type
+    typedef typename wiring::detail::utilities<WiringModelAPI>::template all_out_arr_value_types<numpy::mpl::is_scalar>::type
             all_out_arr_value_types_are_scalars;
 
     typedef typename boost::mpl::if_<
@@ -284,7 +292,7 @@ struct select_std_vector_of_scalar_return_to_core_shape_data_impl<WiringModelAPI
             has_correct_dim;
 
     // Check if the one-and-only output array has a scalar data holding type.
-    typedef typename is_scalar<typename WiringModelAPI::template out_arr_value_type<0>::type>::type
+    typedef typename numpy::mpl::is_scalar<typename WiringModelAPI::template out_arr_value_type<0>::type>::type
             has_scalar_array_data_holding_type;
 
     typedef typename boost::mpl::if_<
@@ -299,6 +307,262 @@ struct select_std_vector_of_scalar_return_to_core_shape_data_impl<WiringModelAPI
             type;
 };
 
+//------------------------------------------------------------------------------
+// The fixed_size_array_return_to_core_shape_data_impl template is used to put
+// the function's result data from a one- or two-dimensional fixed-size array
+// of scalars (i.e. a boost::array or a std::array) into the one and only
+// output array. The size of the array is known at compile time, so no shape
+// needs to be determined from the result.
+template <class WiringModelAPI, class OutMapping, class RT, unsigned nd>
+struct fixed_size_array_return_to_core_shape_data_impl;
+
+template <class WiringModelAPI, class OutMapping, class RT>
+struct fixed_size_array_return_to_core_shape_data_impl<WiringModelAPI, OutMapping, RT, 1>
+{
+    typedef fixed_size_array_return_to_core_shape_data_impl<WiringModelAPI, OutMapping, RT, 1>
+            type;
+
+    typedef typename remove_cv<typename remove_reference<RT>::type>::type
+            array_t;
+
+    typedef typename WiringModelAPI::template out_arr_value_type<0>::type
+            out_arr_value_t;
+
+    BOOST_STATIC_CONSTANT(intptr_t, N = numpy::mpl::fixed_size_array_size<array_t>::value);
+
+    fixed_size_array_return_to_core_shape_data_impl(
+        numpy::detail::iter &                        iter
+      , std::vector< std::vector<intptr_t> > const & out_core_shapes
+    )
+      : iter_(iter)
+      , out_core_shapes_(out_core_shapes)
+      , op_stride_(iter_.get_operand(0).get_strides_vector().back())
+    {
+        BOOST_ASSERT((out_core_shapes_.size() == 1 && out_core_shapes_[0].size() == 1));
+    }
+
+    inline
+    bool
+    operator()(array_t const & result)
+    {
+        if(out_core_shapes_[0][0] != N)
+        {
+            std::cerr << "The size "<< intptr_t(N) <<" of the function's result array "
+                      << "must be "<< out_core_shapes_[0][0] <<"!" << std::endl;
+            return false;
+        }
+
+        char * data = iter_.get_data(0);
+        for(intptr_t i=0; i<N; ++i, data += op_stride_)
+        {
+            *reinterpret_cast<out_arr_value_t *>(data) = out_arr_value_t(result[i]);
+        }
+
+        return true;
+    }
+
+    numpy::detail::iter &                        iter_;
+    std::vector< std::vector<intptr_t> > const & out_core_shapes_;
+    intptr_t const                               op_stride_;
+};
+
+template <class WiringModelAPI, class OutMapping, class RT>
+struct fixed_size_array_return_to_core_shape_data_impl<WiringModelAPI, OutMapping, RT, 2>
+{
+    typedef fixed_size_array_return_to_core_shape_data_impl<WiringModelAPI, OutMapping, RT, 2>
+            type;
+
+    typedef typename remove_cv<typename remove_reference<RT>::type>::type
+            array_t;
+    typedef typename remove_cv<typename array_t::value_type>::type
+            array_value_t;
+
+    typedef typename WiringModelAPI::template out_arr_value_type<0>::type
+            out_arr_value_t;
+
+    BOOST_STATIC_CONSTANT(intptr_t, N = numpy::mpl::fixed_size_array_size<array_t>::value);
+    BOOST_STATIC_CONSTANT(intptr_t, M = numpy::mpl::fixed_size_array_size<array_value_t>::value);
+
+    fixed_size_array_return_to_core_shape_data_impl(
+        numpy::detail::iter &                        iter
+      , std::vector< std::vector<intptr_t> > const & out_core_shapes
+    )
+      : iter_(iter)
+      , out_core_shapes_(out_core_shapes)
+      , op_strides_(iter_.get_operand(0).get_strides_vector())
+      , op_stride0_(op_strides_[op_strides_.size()-2])
+      , op_stride1_(op_strides_[op_strides_.size()-1])
+    {
+        BOOST_ASSERT((out_core_shapes_.size() == 1 && out_core_shapes_[0].size() == 2));
+    }
+
+    inline
+    bool
+    operator()(array_t const & result)
+    {
+        if(out_core_shapes_[0][0] != N || out_core_shapes_[0][1] != M)
+        {
+            std::cerr << "The shape ("<< intptr_t(N) <<", "<< intptr_t(M) <<") of the function's "
+                      << "result array must be "
+                      << numpy::detail::shape_vector_to_string<intptr_t>(out_core_shapes_[0])
+                      << "!" << std::endl;
+            return false;
+        }
+
+        char * const data = iter_.get_data(0);
+        for(intptr_t i=0; i<N; ++i)
+        {
+            char * row_data = data + i*op_stride0_;
+            for(intptr_t j=0; j<M; ++j, row_data += op_stride1_)
+            {
+                *reinterpret_cast<out_arr_value_t *>(row_data) = out_arr_value_t(result[i][j]);
+            }
+        }
+
+        return true;
+    }
+
+    numpy::detail::iter &                        iter_;
+    std::vector< std::vector<intptr_t> > const & out_core_shapes_;
+    std::vector<intptr_t> const                  op_strides_;
+    intptr_t const                               op_stride0_;
+    intptr_t const                               op_stride1_;
+};
+
+// The fixed_size_array_to_scalars_return_to_core_shape_data_impl template is
+// used to distribute the N elements of a one-dimensional fixed-size array of
+// scalars over N scalar output arrays.
+template <class WiringModelAPI, class OutMapping, class RT>
+struct fixed_size_array_to_scalars_return_to_core_shape_data_impl
+{
+    typedef fixed_size_array_to_scalars_return_to_core_shape_data_impl<WiringModelAPI, OutMapping, RT>
+            type;
+
+    typedef typename remove_cv<typename remove_reference<RT>::type>::type
+            array_t;
+
+    typedef typename WiringModelAPI::template out_arr_value_type<0>::type
+            out_arr_value_t;
+
+    BOOST_STATIC_CONSTANT(intptr_t, N = numpy::mpl::fixed_size_array_size<array_t>::value);
+
+    fixed_size_array_to_scalars_return_to_core_shape_data_impl(
+        numpy::detail::iter &                        iter
+      , std::vector< std::vector<intptr_t> > const & out_core_shapes
+    )
+      : iter_(iter)
+    {
+        BOOST_ASSERT((out_core_shapes.size() == size_t(N)));
+    }
+
+    inline
+    bool
+    operator()(array_t const & result)
+    {
+        for(intptr_t i=0; i<N; ++i)
+        {
+            *reinterpret_cast<out_arr_value_t *>(iter_.get_data(i)) = out_arr_value_t(result[i]);
+        }
+
+        return true;
+    }
+
+    numpy::detail::iter & iter_;
+};
+
+template <class ArrayT>
+struct fixed_size_array_nd
+  : boost::mpl::if_<
+        typename numpy::mpl::is_fixed_size_array<typename remove_cv<typename ArrayT::value_type>::type>::type
+      , boost::mpl::int_<2>
+      , boost::mpl::int_<1>
+    >::type
+{};
+
+template <class WiringModelAPI, class OutMapping, class RT>
+struct select_fixed_size_array_return_to_core_shape_data_impl
+{
+    typedef typename remove_cv<typename remove_reference<RT>::type>::type
+            array_t;
+
+    typedef mapping::detail::out_mapping<OutMapping>
+            out_mapping_utils;
+
+    BOOST_STATIC_CONSTANT(unsigned, nd = fixed_size_array_nd<array_t>::value);
+    BOOST_STATIC_CONSTANT(unsigned, N = numpy::mpl::fixed_size_array_size<array_t>::value);
+
+    // Check if the output arrays have a scalar data holding type.
+    typedef typename wiring::detail::utilities<WiringModelAPI>::template all_out_arr_value_types<numpy::mpl::is_scalar>::type
+            all_out_arr_value_types_are_scalars;
+
+    // Check if the one and only output array has the dimensionality of the
+    // fixed-size array.
+    typedef boost::mpl::and_<
+              typename out_mapping_utils::template arity_is_equal_to<1>::type
+            , typename out_mapping_utils::template array<0>::template has_dim<nd>::type
+            , all_out_arr_value_types_are_scalars
+            >
+            is_array_out_mapping;
+
+    // Check if the N elements of a one-dimensional array can be distributed
+    // over N scalar output arrays.
+    typedef boost::mpl::and_<
+              boost::mpl::bool_<(nd == 1 && N > 1)>
+            , typename out_mapping_utils::template arity_is_equal_to<N>::type
+            , typename out_mapping_utils::all_arrays_are_scalars::type
+            , all_out_arr_value_types_are_scalars
+            >
+            is_scalars_out_mapping;
+
+    typedef typename boost::mpl::if_<
+              typename is_array_out_mapping::type
+            , fixed_size_array_return_to_core_shape_data_impl<WiringModelAPI, OutMapping, RT, nd>
+
+            , typename boost::mpl::if_<
+                typename is_scalars_out_mapping::type
+              , fixed_size_array_to_scalars_return_to_core_shape_data_impl<WiringModelAPI, OutMapping, RT>
+
+              , numpy::mpl::unspecified
+              >::type
+            >::type
+            type;
+};
+
+//------------------------------------------------------------------------------
+// The tuple_return_to_core_shape_data_impl template is used to put the
+// elements of the function's tuple result into the output arrays, one scalar
+// element per output array. The output arrays can have different data types.
+template <class WiringModelAPI, class OutMapping, class RT, unsigned out_arity>
+struct tuple_return_to_core_shape_data_impl;
+
+#define BOOST_PP_ITERATION_PARAMS_1                                            \
+    (4, (1, BOOST_NUMPY_LIMIT_OUTPUT_ARITY, <boost/numpy/dstream/wiring/converter/return_to_core_shape_data.hpp>, 4))
+#include BOOST_PP_ITERATE()
+
+template <class WiringModelAPI, class OutMapping, class RT>
+struct select_tuple_return_to_core_shape_data_impl
+{
+    typedef typename remove_cv<typename remove_reference<RT>::type>::type
+            tuple_t;
+
+    typedef mapping::detail::out_mapping<OutMapping>
+            out_mapping_utils;
+
+    BOOST_STATIC_CONSTANT(unsigned, N = numpy::mpl::tuple_size<tuple_t>::value);
+
+    typedef typename boost::mpl::if_<
+              typename boost::mpl::and_<
+                typename out_mapping_utils::template arity_is_equal_to<N>::type
+              , typename out_mapping_utils::all_arrays_are_scalars::type
+              , typename wiring::detail::utilities<WiringModelAPI>::template all_out_arr_value_types<numpy::mpl::is_scalar>::type
+              >::type
+            , tuple_return_to_core_shape_data_impl<WiringModelAPI, OutMapping, RT, N>
+
+            , numpy::mpl::unspecified
+            >::type
+            type;
+};
+
 template <class WiringModelAPI, class OutMapping, class RT, class NestedRT, unsigned ND>
 struct std_vector_return_to_core_shape_data
 {
@@ -310,7 +574,7 @@ struct std_vector_return_to_core_shape_data
             vector_bare_value_t;
 
     typedef typename boost::mpl::if_<
-              typename is_scalar<vector_bare_value_t>::type
+              typename numpy::mpl::is_scalar<vector_bare_value_t>::type
             , typename select_std_vector_of_scalar_return_to_core_shape_data_impl<WiringModelAPI, OutMapping, RT, vector_value_t, ND, OutMapping::arity>::type
 
               // TODO: Add check for bp::object vector value type.
@@ -331,12 +595,14 @@ struct select_return_to_core_shape_data_converter
 {
     typedef typename remove_reference<RT>::type
             bare_rt;
+    typedef typename remove_cv<bare_rt>::type
+            bare_nocv_rt;
 
     typedef mapping::detail::out_mapping<OutMapping>
             out_mapping_utils;
 
     typedef typename boost::mpl::if_<
-              typename is_scalar<bare_rt>::type
+              typename numpy::mpl::is_scalar<bare_rt>::type
             , select_scalar_return_to_core_shape_data_impl<WiringModelAPI, OutMapping, RT>
 
             // TODO: Add bp::object types.
@@ -348,7 +614,17 @@ struct select_return_to_core_shape_data_converter
                   typename numpy::mpl::is_std_vector<bare_rt>::type
                 , std_vector_return_to_core_shape_data<WiringModelAPI, OutMapping, RT, RT, 1>
 
-                , numpy::mpl::unspecified
+                , typename boost::mpl::eval_if<
+                    typename numpy::mpl::is_fixed_size_array<bare_nocv_rt>::type
+                  , select_fixed_size_array_return_to_core_shape_data_impl<WiringModelAPI, OutMapping, RT>
+
+                  , typename boost::mpl::eval_if<
+                      typename numpy::mpl::is_tuple<bare_nocv_rt>::type
+                    , select_tuple_return_to_core_shape_data_impl<WiringModelAPI, OutMapping, RT>
+
+                    , numpy::mpl::unspecified
+                    >::type
+                  >::type
                 >::type
               >::type
             >::type
@@ -452,7 +728,7 @@ struct get_multidim_std_vector_shape<VectorT, ND>
 
 
 #define BOOST_NUMPY_DSTREAM_for_dim_begin(z, n, data) \
-    for(dim_indices_[n] = 0; dim_indices_[n] < out_core_shapes_[0][n]; ++dim_indices_[n]) {
+    for(dim_indices_[n] = 0; dim_indices_[n] < out_core_shape_t::template dim_len<n>(out_core_shapes_[0]); ++dim_indices_[n]) {
 
 #define BOOST_NUMPY_DSTREAM_for_dim_end(z, n, data) \
     }
@@ -471,6 +747,14 @@ struct std_vector_of_scalar_return_to_core_shape_data_impl<WiringModelAPI, OutMa
     typedef typename WiringModelAPI::template out_arr_value_type<0>::type
             out_arr_value_t;
 
+    typedef typename wiring::detail::nd_accessor<RT, VectorValueT, ND>::inner_t
+            inner_t;
+
+    // The core shape type of the output array. Its fixed sized dimensions
+    // provide compile-time loop bounds.
+    typedef typename mapping::detail::out_mapping<OutMapping>::template array<0>::array_type
+            out_core_shape_t;
+
     std_vector_of_scalar_return_to_core_shape_data_impl(
         numpy::detail::iter &                        iter
       , std::vector< std::vector<intptr_t> > const & out_core_shapes
@@ -482,6 +766,9 @@ struct std_vector_of_scalar_return_to_core_shape_data_impl<WiringModelAPI, OutMa
       , iter_data_ptr_(iter_, 0, dim_indices_, op_strides_)
       , nd_accessor_(wiring::detail::nd_accessor<RT, VectorValueT, ND>(dim_indices_))
       , check_result_shape_(true)
+        // The elements of the last core dimension are contiguous in memory,
+        // if its stride equals the size of the output array data type.
+      , is_inner_contiguous_(out_core_shapes_[0][ND-1] <= 1 || op_strides_.back() == intptr_t(sizeof(out_arr_value_t)))
     {
         BOOST_ASSERT((out_core_shapes_.size() == 1 && out_core_shapes_[0].size() == ND));
     }
@@ -509,10 +796,36 @@ struct std_vector_of_scalar_return_to_core_shape_data_impl<WiringModelAPI, OutMa
             check_result_shape_ = false;
         }
 
-        BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_for_dim_begin, ND)
-        out_arr_value_t & out_arr_value = *reinterpret_cast<out_arr_value_t *>( iter_data_ptr_() );
-        out_arr_value = out_arr_value_t( nd_accessor_(result) );
-        BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_for_dim_end, ND)
+        BOOST_PP_REPEAT(BOOST_PP_SUB(ND,1), BOOST_NUMPY_DSTREAM_for_dim_begin, ND)
+        // The full result shape is only checked for the first element. The
+        // length of each innermost vector is checked for every element, so a
+        // ragged result can't write beyond its output core dimension.
+        dim_indices_[ND-1] = 0;
+        inner_t const & inner = nd_accessor_.inner(result);
+        if(intptr_t(inner.size()) != out_core_shape_t::template dim_len<ND-1>(out_core_shapes_[0]))
+        {
+            std::cerr << "The length " << inner.size()
+                      << " of the last dimension of the function's result"
+                      << " vector must be "
+                      << out_core_shape_t::template dim_len<ND-1>(out_core_shapes_[0])
+                      << "!"
+                      << std::endl;
+            return false;
+        }
+        if(is_inner_contiguous_)
+        {
+            // Copy the entire last dimension of the result at once into the
+            // contiguous output array data.
+            std::copy(inner.begin(), inner.end(), reinterpret_cast<out_arr_value_t *>( iter_data_ptr_() ));
+        }
+        else
+        {
+            BOOST_NUMPY_DSTREAM_for_dim_begin(~, BOOST_PP_SUB(ND,1), ND)
+            out_arr_value_t & out_arr_value = *reinterpret_cast<out_arr_value_t *>( iter_data_ptr_() );
+            out_arr_value = out_arr_value_t( nd_accessor_(result) );
+            BOOST_NUMPY_DSTREAM_for_dim_end(~, BOOST_PP_SUB(ND,1), ND)
+        }
+        BOOST_PP_REPEAT(BOOST_PP_SUB(ND,1), BOOST_NUMPY_DSTREAM_for_dim_end, ND)
 
         return true;
     }
@@ -524,6 +837,7 @@ struct std_vector_of_scalar_return_to_core_shape_data_impl<WiringModelAPI, OutMa
     wiring::detail::iter_data_ptr<ND, 0>              iter_data_ptr_;
     wiring::detail::nd_accessor<RT, VectorValueT, ND> nd_accessor_;
     bool                                              check_result_shape_;
+    bool const                                        is_inner_contiguous_;
 };
 
 #undef BOOST_NUMPY_DSTREAM_for_dim_end
@@ -641,8 +955,58 @@ struct std_vector_of_scalar_return_to_core_shape_data_impl<WiringModelAPI, OutMa
 #undef ND
 #undef OUT_ARITY
 
-#endif // (BOOST_PP_ITERATION_DEPTH() == 2) && (BOOST_PP_ITERATION_FLAGS() == 1)
+#else
+#if (BOOST_PP_ITERATION_DEPTH() == 1) && (BOOST_PP_ITERATION_FLAGS() == 4)
+
+#define OUT_ARITY BOOST_PP_ITERATION()
+
+#define BOOST_NUMPY_DSTREAM_out_arr_value_type(z, n, data)                     \
+    typedef typename WiringModelAPI::template out_arr_value_type<n>::type      \
+            BOOST_PP_CAT(out_arr_value_t,n);
+
+#define BOOST_NUMPY_DSTREAM_out_arr_value_set(z, n, data)                      \
+    *reinterpret_cast<BOOST_PP_CAT(out_arr_value_t,n) *>(iter_.get_data(n)) =  \
+        BOOST_PP_CAT(out_arr_value_t,n)( numpy::mpl::tuple_element<n, tuple_t>::get(result) );
+
+template <class WiringModelAPI, class OutMapping, class RT>
+struct tuple_return_to_core_shape_data_impl<WiringModelAPI, OutMapping, RT, OUT_ARITY>
+{
+    typedef tuple_return_to_core_shape_data_impl<WiringModelAPI, OutMapping, RT, OUT_ARITY>
+            type;
+
+    typedef typename remove_cv<typename remove_reference<RT>::type>::type
+            tuple_t;
+
+    BOOST_PP_REPEAT(OUT_ARITY, BOOST_NUMPY_DSTREAM_out_arr_value_type, ~)
 
+    tuple_return_to_core_shape_data_impl(
+        numpy::detail::iter &                        iter
+      , std::vector< std::vector<intptr_t> > const & out_core_shapes
+    )
+      : iter_(iter)
+    {
+        BOOST_ASSERT((out_core_shapes.size() == OUT_ARITY));
+    }
+
+    inline
+    bool
+    operator()(tuple_t const & result)
+    {
+        BOOST_PP_REPEAT(OUT_ARITY, BOOST_NUMPY_DSTREAM_out_arr_value_set, ~)
+
+        return true;
+    }
+
+    numpy::detail::iter & iter_;
+};
+
+#undef BOOST_NUMPY_DSTREAM_out_arr_value_set
+#undef BOOST_NUMPY_DSTREAM_out_arr_value_type
+
+#undef OUT_ARITY
+
+#endif // (BOOST_PP_ITERATION_DEPTH() == 1) && (BOOST_PP_ITERATION_FLAGS() == 4)
+#endif // (BOOST_PP_ITERATION_DEPTH() == 2) && (BOOST_PP_ITERATION_FLAGS() == 1)
 #endif // (BOOST_PP_ITERATION_DEPTH() == 1) && (BOOST_PP_ITERATION_FLAGS() == 3)
 #endif // (BOOST_PP_ITERATION_DEPTH() == 1) && (BOOST_PP_ITERATION_FLAGS() == 2)
 #endif // (BOOST_PP_ITERATION_DEPTH() == 1) && (BOOST_PP_ITERATION_FLAGS() == 1)
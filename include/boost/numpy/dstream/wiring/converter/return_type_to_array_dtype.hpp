@@ -24,10 +24,15 @@
 #define BOOST_NUMPY_DSTREAM_WIRING_RETURN_TYPE_TO_ARRAY_DTYPE_HPP_INCLUDED
 
 #include <boost/mpl/assert.hpp>
+#include <boost/mpl/eval_if.hpp>
 #include <boost/mpl/identity.hpp>
 #include <boost/mpl/if.hpp>
+#include <boost/type_traits/remove_cv.hpp>
 
+#include <boost/numpy/mpl/is_fixed_size_array.hpp>
+#include <boost/numpy/mpl/is_scalar.hpp>
 #include <boost/numpy/mpl/is_std_vector.hpp>
+#include <boost/numpy/mpl/is_tuple.hpp>
 
 namespace boost {
 namespace numpy {
@@ -60,7 +65,7 @@ struct std_vector_return_type_to_array_dtype
             vector_bare_value_t;
 
     typedef typename boost::mpl::if_<
-              typename is_scalar<vector_bare_value_t>::type
+              typename numpy::mpl::is_scalar<vector_bare_value_t>::type
             , vector_bare_value_t
 
             , typename boost::mpl::if_<
@@ -78,14 +83,59 @@ struct std_vector_return_type_to_array_dtype
             type;
 };
 
+// The data type of the output array(s) of a (possibly two-dimensional)
+// fixed-size array is its scalar value type.
+template <class OutMapping, class RT, unsigned idx>
+struct fixed_size_array_return_type_to_array_dtype
+{
+    typedef typename remove_cv<typename remove_reference<RT>::type>::type
+            array_t;
+    typedef typename remove_cv<typename array_t::value_type>::type
+            array_bare_value_t;
+
+    typedef typename boost::mpl::if_<
+              typename numpy::mpl::is_scalar<array_bare_value_t>::type
+            , array_bare_value_t
+
+            , typename boost::mpl::eval_if<
+                typename numpy::mpl::is_fixed_size_array<array_bare_value_t>::type
+              , fixed_size_array_return_type_to_array_dtype<OutMapping, array_bare_value_t, idx>
+
+              , numpy::mpl::unspecified
+              >::type
+            >::type
+            type;
+};
+
+// The data type of the idx'th output array of a tuple is the type of its
+// idx'th element.
+template <class OutMapping, class RT, unsigned idx>
+struct tuple_return_type_to_array_dtype
+{
+    typedef typename remove_cv<typename remove_reference<RT>::type>::type
+            tuple_t;
+    typedef typename remove_cv<typename numpy::mpl::tuple_element<idx, tuple_t>::type>::type
+            element_t;
+
+    typedef typename boost::mpl::if_<
+              typename numpy::mpl::is_scalar<element_t>::type
+            , element_t
+
+            , numpy::mpl::unspecified
+            >::type
+            type;
+};
+
 template <class OutMapping, class RT, unsigned idx>
 struct select_return_type_to_array_dtype
 {
     typedef typename remove_reference<RT>::type
             bare_rt;
+    typedef typename remove_cv<bare_rt>::type
+            bare_nocv_rt;
 
     typedef typename boost::mpl::if_<
-              typename is_scalar<bare_rt>::type
+              typename numpy::mpl::is_scalar<bare_rt>::type
             , boost::mpl::identity<bare_rt>
 
             , typename boost::mpl::if_<
@@ -96,7 +146,17 @@ struct select_return_type_to_array_dtype
                   typename numpy::mpl::is_std_vector<bare_rt>::type
                 , std_vector_return_type_to_array_dtype<OutMapping, RT, idx>
 
-                , numpy::mpl::unspecified
+                , typename boost::mpl::if_<
+                    typename numpy::mpl::is_fixed_size_array<bare_nocv_rt>::type
+                  , fixed_size_array_return_type_to_array_dtype<OutMapping, RT, idx>
+
+                  , typename boost::mpl::if_<
+                      typename numpy::mpl::is_tuple<bare_nocv_rt>::type
+                    , tuple_return_type_to_array_dtype<OutMapping, RT, idx>
+
+                    , numpy::mpl::unspecified
+                    >::type
+                  >::type
                 >::type
               >::type
             >::type
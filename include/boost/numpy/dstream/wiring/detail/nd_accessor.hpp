@@ -27,15 +27,34 @@
 
 #include <vector>
 
+#include <boost/preprocessor/arithmetic/sub.hpp>
 #include <boost/preprocessor/iterate.hpp>
 #include <boost/preprocessor/repetition/repeat.hpp>
 
+#include <boost/type_traits/remove_reference.hpp>
+
 namespace boost {
 namespace numpy {
 namespace dstream {
 namespace wiring {
 namespace detail {
 
+// The nd_value_type template determines the value type of a n-times nested
+// container type T, e.g. the innermost std::vector of a nested std::vector.
+template <class T, unsigned n>
+struct nd_value_type
+{
+    typedef typename nd_value_type<typename remove_reference<T>::type::value_type, n-1>::type
+            type;
+};
+
+template <class T>
+struct nd_value_type<T, 0>
+{
+    typedef typename remove_reference<T>::type
+            type;
+};
+
 template <class T, class ValueT, unsigned nd>
 struct nd_accessor;
 
@@ -72,6 +91,9 @@ struct nd_accessor<T, ValueT, ND>
       : BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_dim_indices_init, ~)
     {}
 
+    typedef typename nd_value_type<T, BOOST_PP_SUB(ND,1)>::type
+            inner_t;
+
     inline
     ValueT
     operator()(T const & nd_obj)
@@ -79,6 +101,18 @@ struct nd_accessor<T, ValueT, ND>
         return nd_obj BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_access, ~) ;
     }
 
+    /**
+     * \brief Returns the innermost (one-dimensional) object of the
+     *     nd-dimensional object, i.e. the object that is selected by all but
+     *     the last dimension index.
+     */
+    inline
+    inner_t const &
+    inner(T const & nd_obj)
+    {
+        return nd_obj BOOST_PP_REPEAT(BOOST_PP_SUB(ND,1), BOOST_NUMPY_DSTREAM_access, ~) ;
+    }
+
     BOOST_PP_REPEAT(ND, BOOST_NUMPY_DSTREAM_dim_indices_def, ~)
 };
 
@@ -23,9 +23,18 @@
 #ifndef BOOST_NUMPY_DSTREAM_WIRING_GENERALIZED_WIRING_MODEL_HPP_INCLUDED
 #define BOOST_NUMPY_DSTREAM_WIRING_GENERALIZED_WIRING_MODEL_HPP_INCLUDED
 
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/assert.hpp>
 #include <boost/mpl/bitor.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/eval_if.hpp>
 #include <boost/mpl/if.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
 
+#include <boost/numpy/mpl/is_scalar.hpp>
 #include <boost/numpy/mpl/is_type_of.hpp>
 #include <boost/numpy/mpl/types_from_fctptr_signature.hpp>
 #include <boost/numpy/dstream/wiring.hpp>
@@ -52,7 +61,14 @@ struct generalized_wiring_model_api
     {
         typedef typename FTypes::return_type
                 return_type;
-        typedef typename converter::detail::return_type_to_array_dtype<typename MappingDefinition::out, return_type, Idx>::type
+
+        // The output arrays of a function returning void are filled through
+        // the trailing output arguments of the function.
+        typedef typename boost::mpl::eval_if_c<
+                  FTypes::has_void_return
+                , converter::detail::arg_type_to_array_dtype<typename numpy::mpl::fct_arg_type<FTypes, MappingDefinition::in::arity + Idx>::type>
+                , converter::detail::return_type_to_array_dtype<typename MappingDefinition::out, return_type, Idx>
+                >::type
                 type;
     };
 
@@ -87,6 +103,35 @@ struct generalized_wiring_model_api
                 type;
     };
 
+    // Input arrays with a scalar core shape are read element by element
+    // through the iterator. Object arrays are excluded, because they need the
+    // REFS_OK iterator flag.
+    template <unsigned Idx>
+    struct in_arr_is_scalar_non_object
+    {
+        typedef typename boost::mpl::and_<
+                  typename mapping::detail::is_scalar<typename mapping::detail::in_mapping<typename MappingDefinition::in>::template array<Idx>::core_shape_t>::type
+                , typename boost::mpl::not_< is_same<typename in_arr_value_type<Idx>::type, python::object> >::type
+                >::type
+                type;
+    };
+
+    // Such input arrays can be bound as constant arguments, when they hold
+    // only one element.
+    template <unsigned Idx>
+    struct in_arr_is_bindable
+      : in_arr_is_scalar_non_object<Idx>
+    {};
+
+    // Such input arrays can also be cast chunk-wise by the iterator into its
+    // buffers. Arrays with core dimensions are accessed through their own
+    // strides, so they must have the data type of the function argument
+    // already.
+    template <unsigned Idx>
+    struct in_arr_is_buffer_castable
+      : in_arr_is_scalar_non_object<Idx>
+    {};
+
     template <class LoopService>
     struct iter_flags
     {
@@ -116,22 +161,250 @@ struct generalized_wiring_model_api
     BOOST_STATIC_CONSTANT(numpy::casting_t, casting = numpy::SAME_KIND_CASTING);
 
     BOOST_STATIC_CONSTANT(intptr_t, buffersize = 0);
+
+    // The input arrays are converted entirely to the data types of the
+    // function arguments before the iteration starts.
+    BOOST_STATIC_CONSTANT(bool, buffered_casting = false);
+
+    // The function results overwrite the values of the output arrays.
+    BOOST_STATIC_CONSTANT(bool, accumulates = false);
+
+    // The result_converter metafunction selects the converter, which puts the
+    // function result of type RT into the output arrays.
+    template <class RT>
+    struct result_converter
+    {
+        typedef typename converter::detail::return_to_core_shape_data_converter<
+                  generalized_wiring_model_api<MappingDefinition, FTypes>
+                , typename MappingDefinition::out
+                , RT
+                >::type
+                type;
+    };
+};
+
+/**
+ * The buffered_casting_wiring_model_api template is the API of the generalized
+ * wiring model with buffered casting. Input arrays with a scalar core shape
+ * are passed unconverted to the iterator, which casts, aligns and byte-swaps
+ * their data chunk-wise into buffers of BufferSize elements (0 selects the
+ * numpy default). GROWINNER lets the inner loop grow beyond the buffer size,
+ * when no operand needs buffering.
+ */
+template <intptr_t BufferSize, class MappingDefinition, class FTypes>
+struct buffered_casting_wiring_model_api
+  : generalized_wiring_model_api<MappingDefinition, FTypes>
+{
+    typedef generalized_wiring_model_api<MappingDefinition, FTypes>
+            base_t;
+
+    template <unsigned Idx>
+    struct in_arr_iter_operand_flags
+    {
+        typedef boost::mpl::bitor_<
+                    typename numpy::detail::iter_operand::flags::READONLY
+                  , typename numpy::detail::iter_operand::flags::NBO
+                  , typename numpy::detail::iter_operand::flags::ALIGNED
+                >
+                type;
+    };
+
+    template <class LoopService>
+    struct iter_flags
+    {
+        typedef boost::mpl::bitor_<
+                  typename base_t::template iter_flags<LoopService>::type::type
+                , typename numpy::detail::iter::flags::GROWINNER
+                >
+                type;
+    };
+
+    // The whole-array conversion was done by numpy.from_object, which allows
+    // only safe casts. So the iterator does the same.
+    BOOST_STATIC_CONSTANT(numpy::casting_t, casting = numpy::SAFE_CASTING);
+
+    BOOST_STATIC_CONSTANT(intptr_t, buffersize = BufferSize);
+
+    BOOST_STATIC_CONSTANT(bool, buffered_casting = true);
+};
+
+/**
+ * The is_masked_chunk function returns true, if all size elements of the
+ * current inner loop chunk of the iterator are masked out by the mask operand
+ * with index mask_op_idx. Such chunks are skipped entirely.
+ */
+inline
+bool
+is_masked_chunk(numpy::detail::iter & iter, int mask_op_idx, intptr_t size)
+{
+    char const * mask = iter.get_data(mask_op_idx);
+    intptr_t const stride = iter.get_inner_loop_stride(mask_op_idx);
+    if(stride == 0) {
+        return (size == 0 || ! *mask);
+    }
+    for(; size > 0; --size, mask += stride)
+    {
+        if(*mask) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * The accumulate_scalar_return_to_core_shape_data_impl template combines the
+ * scalar function result with the present value of the one and only output
+ * array through the binary operation Op, e.g. dstream::add.
+ */
+template <class Op, class WiringModelAPI, class RT>
+struct accumulate_scalar_return_to_core_shape_data_impl
+{
+    typedef accumulate_scalar_return_to_core_shape_data_impl<Op, WiringModelAPI, RT>
+            type;
+
+    typedef typename WiringModelAPI::template out_arr_value_type<0>::type
+            out_arr_value_t;
+
+    accumulate_scalar_return_to_core_shape_data_impl(
+        numpy::detail::iter &                        iter
+      , std::vector< std::vector<intptr_t> > const & out_core_shapes
+    )
+      : iter_(iter)
+    {
+        BOOST_ASSERT((out_core_shapes.size()    == 1 &&
+                      out_core_shapes[0].size() == 0));
+    }
+
+    inline
+    bool
+    operator()(RT result)
+    {
+        out_arr_value_t & out_arr_value = *reinterpret_cast<out_arr_value_t *>(iter_.get_data(0));
+        out_arr_value = Op::apply(out_arr_value, out_arr_value_t(result));
+
+        return true;
+    }
+
+    numpy::detail::iter & iter_;
+};
+
+/**
+ * The accumulating_wiring_model_api template is the API of the generalized
+ * wiring model, which accumulates the function results into the provided
+ * output array. The output operand is opened READWRITE, so no temporary
+ * result array and no second pass over the data is needed.
+ */
+template <class Op, class MappingDefinition, class FTypes>
+struct accumulating_wiring_model_api
+  : generalized_wiring_model_api<MappingDefinition, FTypes>
+{
+    typedef generalized_wiring_model_api<MappingDefinition, FTypes>
+            base_t;
+
+    // Accumulation is supported for functions returning one scalar value.
+    typedef boost::mpl::bool_<
+                 ! FTypes::has_void_return
+              && MappingDefinition::out::arity == 1
+              && mapping::detail::out_mapping<typename MappingDefinition::out>::template array<0>::is_scalar::type::value
+              && numpy::mpl::is_scalar<typename remove_cv<typename remove_reference<typename FTypes::return_type>::type>::type>::type::value
+            >
+            is_valid_fct_t;
+    BOOST_MPL_ASSERT_MSG(is_valid_fct_t::value,
+        ACCUMULATION_IS_ONLY_SUPPORTED_FOR_FUNCTIONS_RETURNING_ONE_SCALAR_VALUE
+        , (MappingDefinition, FTypes));
+
+    template <unsigned Idx>
+    struct out_arr_iter_operand_flags
+    {
+        typedef boost::mpl::bitor_<
+                    typename numpy::detail::iter_operand::flags::READWRITE
+                  , typename numpy::detail::iter_operand::flags::NBO
+                  , typename numpy::detail::iter_operand::flags::ALIGNED
+                >
+                type;
+    };
+
+    BOOST_STATIC_CONSTANT(bool, accumulates = true);
+
+    template <class RT>
+    struct result_converter
+    {
+        typedef accumulate_scalar_return_to_core_shape_data_impl<Op, base_t, RT>
+                type;
+    };
+};
+
+template <class MappingDefinition, class FTypes, unsigned Idx>
+struct generalized_wiring_model_in_arg_converter
+{
+    typedef typename converter::detail::arg_from_core_shape_data_converter<
+              typename numpy::mpl::fct_arg_type<FTypes, Idx>::type
+            , typename mapping::detail::in_mapping<typename MappingDefinition::in>::template array<Idx>::core_shape_t
+            , typename generalized_wiring_model_api<MappingDefinition, FTypes>::template in_arr_value_type<Idx>::type
+            >::type
+            type;
+};
+
+template <class MappingDefinition, class FTypes, unsigned Idx>
+struct generalized_wiring_model_out_arg_converter
+{
+    BOOST_STATIC_CONSTANT(unsigned, out_idx = Idx - MappingDefinition::in::arity);
+
+    typedef typename converter::detail::arg_from_core_shape_data_converter<
+              typename numpy::mpl::fct_arg_type<FTypes, Idx>::type
+            , typename mapping::detail::out_mapping<typename MappingDefinition::out>::template array<out_idx>::array_type
+            , typename generalized_wiring_model_api<MappingDefinition, FTypes>::template out_arr_value_type<out_idx>::type
+            >::type
+            type;
+};
+
+// The first MappingDefinition::in::arity function arguments are input
+// arguments, all remaining arguments are output arguments. Output arguments
+// refer to the data of the output arrays.
+template <class MappingDefinition, class FTypes, unsigned Idx>
+struct generalized_wiring_model_arg_converter
+{
+    typedef typename boost::mpl::eval_if_c<
+              (Idx < MappingDefinition::in::arity)
+            , generalized_wiring_model_in_arg_converter<MappingDefinition, FTypes, Idx>
+            , generalized_wiring_model_out_arg_converter<MappingDefinition, FTypes, Idx>
+            >::type
+            type;
 };
 
-template <unsigned in_arity>
+template <unsigned fct_arity>
 struct generalized_wiring_model_arity;
 
 #define BOOST_PP_ITERATION_PARAMS_1                                            \
     (4, (1, BOOST_NUMPY_LIMIT_INPUT_ARITY, <boost/numpy/dstream/wiring/generalized_wiring_model.hpp>, 1))
 #include BOOST_PP_ITERATE()
 
-template <class MappingDefinition, class FTypes>
+// The API template parameter allows variants of the generalized wiring model,
+// which differ only in their API, e.g. in the iterator operand flags.
+template <
+      class MappingDefinition
+    , class FTypes
+    , class API = generalized_wiring_model_api<MappingDefinition, FTypes>
+>
 struct select_generalized_wiring_model_impl
 {
-    typedef typename generalized_wiring_model_arity<MappingDefinition::in::arity>::template impl<
+    // The function must have an argument for each input array and, if it
+    // returns void, it can have an output argument for each output array.
+    typedef boost::mpl::bool_<
+                 FTypes::arity == MappingDefinition::in::arity
+              || (   FTypes::has_void_return
+                  && FTypes::arity == MappingDefinition::in::arity + MappingDefinition::out::arity)
+            >
+            is_valid_fct_arity_t;
+    BOOST_MPL_ASSERT_MSG(is_valid_fct_arity_t::value,
+        THE_NUMBER_OF_FUNCTION_ARGUMENTS_MUST_MATCH_THE_NUMBER_OF_INPUT_ARRAYS_OR_THE_NUMBER_OF_INPUT_AND_OUTPUT_ARRAYS
+        , (MappingDefinition, FTypes));
+
+    typedef typename generalized_wiring_model_arity<FTypes::arity>::template impl<
               FTypes::has_void_return
             , MappingDefinition
             , FTypes
+            , API
             >::type
             apply;
 };
@@ -156,6 +429,109 @@ struct generalized_wiring_model_selector
 };
 
 }// namespace wiring
+
+/**
+ * The add, maximum and minimum binary operations combine a function result
+ * with the present value of the output array in accumulate mode.
+ */
+struct add
+{
+    template <class T>
+    static
+    T
+    apply(T const & out, T const & value)
+    {
+        return out + value;
+    }
+};
+
+struct maximum
+{
+    template <class T>
+    static
+    T
+    apply(T const & out, T const & value)
+    {
+        return (value > out ? value : out);
+    }
+};
+
+struct minimum
+{
+    template <class T>
+    static
+    T
+    apply(T const & out, T const & value)
+    {
+        return (value < out ? value : out);
+    }
+};
+
+/**
+ * The accumulate wiring model selector selects the generalized wiring model,
+ * but combines each function result with the present value of the output
+ * array through the binary operation Op (add, maximum or minimum), e.g.
+ *
+ *     dstream::def("f_acc", &f, (bp::arg("x"), "y"), dstream::accumulate<dstream::add>());
+ *
+ * computes out += f(x, y) in one pass. The out argument must be given. Only
+ * functions returning one scalar value can accumulate.
+ */
+template <class Op>
+struct accumulate
+  : wiring::wiring_model_selector_type
+{
+    typedef accumulate<Op>
+            type;
+
+    template <
+         class MappingDefinition
+       , class FTypes
+    >
+    struct select
+    {
+        typedef typename wiring::detail::select_generalized_wiring_model_impl<
+                  MappingDefinition
+                , FTypes
+                , wiring::detail::accumulating_wiring_model_api<Op, MappingDefinition, FTypes>
+                >::apply
+                type;
+    };
+};
+
+/**
+ * The buffered_casting wiring model selector selects the generalized wiring
+ * model, but lets the iterator cast the input arrays chunk-wise into its
+ * buffers, instead of converting each input array entirely before the
+ * iteration. This avoids a full copy of input arrays, whose data type,
+ * alignment or byte order does not match the function argument, e.g.
+ *
+ *     dstream::def("f", &f, (bp::arg("x"), "y"), dstream::buffered_casting<8192>());
+ *
+ * The buffer size is given in array elements. 0 selects the numpy default.
+ */
+template <intptr_t BufferSize = 0>
+struct buffered_casting
+  : wiring::wiring_model_selector_type
+{
+    typedef buffered_casting<BufferSize>
+            type;
+
+    template <
+         class MappingDefinition
+       , class FTypes
+    >
+    struct select
+    {
+        typedef typename wiring::detail::select_generalized_wiring_model_impl<
+                  MappingDefinition
+                , FTypes
+                , wiring::detail::buffered_casting_wiring_model_api<BufferSize, MappingDefinition, FTypes>
+                >::apply
+                type;
+    };
+};
+
 }// namespace dstream
 }// namespace numpy
 }// namespace boost
@@ -165,47 +541,51 @@ struct generalized_wiring_model_selector
 
 #if BOOST_PP_ITERATION_FLAGS() == 1
 
-#define IN_ARITY BOOST_PP_ITERATION()
+#define FCT_ARITY BOOST_PP_ITERATION()
 
 #define BOOST_NUMPY_DSTREAM_DEF_arg_converter_type(z, n, data)                 \
-    typedef typename converter::detail::arg_from_core_shape_data_converter<    \
-              typename numpy::mpl::fct_arg_type<FTypes, n>::type               \
-            , typename mapping::detail::in_mapping<typename MappingDefinition::in>::template array<n>::core_shape_t \
-            , typename api::template in_arr_value_type<n>::type                \
-            >::type                                                            \
+    typedef typename generalized_wiring_model_arg_converter<MappingDefinition, FTypes, n>::type \
             BOOST_PP_CAT(arg_converter_t,n);
 
-#define BOOST_NUMPY_DSTREAM_DEF_arg_converter(z, n, data) \
-    BOOST_PP_CAT(arg_converter_t,n) BOOST_PP_CAT(arg_converter,n)(iter, MappingDefinition::out::arity + n, in_core_shapes[n]);
+// Input arguments, which are bound as constants, are read from their own
+// iterator object (with operand index 0), all others are operands of the
+// main iterator. Output arguments refer to the output operands, which are the
+// first operands of the main iterator.
+#define BOOST_NUMPY_DSTREAM_DEF_arg_converter(z, n, data)                      \
+    bool const BOOST_PP_CAT(is_in_arg,n) = (n < MappingDefinition::in::arity); \
+    numpy::detail::iter & BOOST_PP_CAT(arg_iter,n) = (BOOST_PP_CAT(is_in_arg,n) && in_bound_iters[n] ? *in_bound_iters[n] : iter); \
+    size_t const BOOST_PP_CAT(arg_iter_op_idx,n) = (BOOST_PP_CAT(is_in_arg,n) ? (in_bound_iters[n] ? 0 : iter_op_idx++) : n - MappingDefinition::in::arity); \
+    BOOST_PP_CAT(arg_converter_t,n) BOOST_PP_CAT(arg_converter,n)(BOOST_PP_CAT(arg_iter,n), BOOST_PP_CAT(arg_iter_op_idx,n), (BOOST_PP_CAT(is_in_arg,n) ? in_core_shapes[n] : out_core_shapes[n - MappingDefinition::in::arity]));
 
 #define BOOST_NUMPY_DSTREAM_DEF__in_arr_value(z, n, data) \
     BOOST_PP_COMMA_IF(n) BOOST_PP_CAT(arg_converter,n)()
 
 template <>
-struct generalized_wiring_model_arity<IN_ARITY>
+struct generalized_wiring_model_arity<FCT_ARITY>
 {
     template <
           bool fct_has_void_return
         , class MappingDefinition
         , class FTypes
+        , class API
     >
     struct impl;
 
     //--------------------------------------------------------------------------
     // Partial specialization for functions returning void.
-    template <class MappingDefinition, class FTypes>
-    struct impl<true, MappingDefinition, FTypes>
+    template <class MappingDefinition, class FTypes, class API>
+    struct impl<true, MappingDefinition, FTypes, API>
       : wiring_model_base<MappingDefinition, FTypes>
     {
-        typedef impl<true, MappingDefinition, FTypes>
+        typedef impl<true, MappingDefinition, FTypes, API>
                 type;
 
-        typedef generalized_wiring_model_api<MappingDefinition, FTypes>
+        typedef API
                 api;
 
         // Define the arg_from_core_shape_data converter types for all the
-        // input arguments.
-        BOOST_PP_REPEAT(IN_ARITY, BOOST_NUMPY_DSTREAM_DEF_arg_converter_type, ~)
+        // function arguments.
+        BOOST_PP_REPEAT(FCT_ARITY, BOOST_NUMPY_DSTREAM_DEF_arg_converter_type, ~)
 
         /** The iterate method of the wiring model does the iteration and the
          *  actual wiring.
@@ -219,12 +599,19 @@ struct generalized_wiring_model_arity<IN_ARITY>
             , numpy::detail::iter & iter
             , std::vector< std::vector<intptr_t> > const & out_core_shapes
             , std::vector< std::vector<intptr_t> > const & in_core_shapes
+            , std::vector<numpy::detail::iter *> const & in_bound_iters
             , bool & error_flag
         )
         {
             // Create an argument data converter instance for each function
             // argument.
-            BOOST_PP_REPEAT(IN_ARITY, BOOST_NUMPY_DSTREAM_DEF_arg_converter, ~)
+            size_t iter_op_idx = MappingDefinition::out::arity;
+            BOOST_PP_REPEAT(FCT_ARITY, BOOST_NUMPY_DSTREAM_DEF_arg_converter, ~)
+
+            // An additional last iterator operand is the mask of the where
+            // argument. Masked-out elements are not computed.
+            int const mask_op_idx = iter_op_idx;
+            bool const is_masked = (mask_op_idx < iter.get_nop());
 
             // Do the iteration loop over the array.
             // Note: The iterator flags is set with EXTERNAL_LOOP in order
@@ -235,12 +622,18 @@ struct generalized_wiring_model_arity<IN_ARITY>
             //       iterator construction.
             do {
                 intptr_t size = iter.get_inner_loop_size();
+                if(is_masked && is_masked_chunk(iter, mask_op_idx, size)) {
+                    continue;
+                }
                 while(size--)
                 {
-                    f_caller.call(
-                        self
-                      , BOOST_PP_REPEAT(IN_ARITY, BOOST_NUMPY_DSTREAM_DEF__in_arr_value, ~)
-                    );
+                    if(! is_masked || *iter.get_data(mask_op_idx))
+                    {
+                        f_caller.call(
+                            self
+                          , BOOST_PP_REPEAT(FCT_ARITY, BOOST_NUMPY_DSTREAM_DEF__in_arr_value, ~)
+                        );
+                    }
 
                     iter.add_inner_loop_strides_to_data_ptrs();
                 }
@@ -250,27 +643,23 @@ struct generalized_wiring_model_arity<IN_ARITY>
 
     //--------------------------------------------------------------------------
     // Partial specialization for functions returning non-void.
-    template <class MappingDefinition, class FTypes>
-    struct impl<false, MappingDefinition, FTypes>
+    template <class MappingDefinition, class FTypes, class API>
+    struct impl<false, MappingDefinition, FTypes, API>
       : wiring_model_base<MappingDefinition, FTypes>
     {
-        typedef impl<false, MappingDefinition, FTypes>
+        typedef impl<false, MappingDefinition, FTypes, API>
                 type;
 
-        typedef generalized_wiring_model_api<MappingDefinition, FTypes>
+        typedef API
                 api;
 
         // Define the arg_from_core_shape_data converter types for all the
-        // input arguments.
-        BOOST_PP_REPEAT(IN_ARITY, BOOST_NUMPY_DSTREAM_DEF_arg_converter_type, ~)
+        // function arguments.
+        BOOST_PP_REPEAT(FCT_ARITY, BOOST_NUMPY_DSTREAM_DEF_arg_converter_type, ~)
 
         // Define the return value converter type, that will be used to transfer
         // the function's return data into the output arrays.
-        typedef typename converter::detail::return_to_core_shape_data_converter<
-                  api
-                , typename MappingDefinition::out
-                , typename FTypes::return_type
-                >::type
+        typedef typename api::template result_converter<typename FTypes::return_type>::type
                 return_to_core_shape_data_t;
 
         /** The iterate method of the wiring model does the iteration and the
@@ -285,27 +674,39 @@ struct generalized_wiring_model_arity<IN_ARITY>
             , numpy::detail::iter & iter
             , std::vector< std::vector<intptr_t> > const & out_core_shapes
             , std::vector< std::vector<intptr_t> > const & in_core_shapes
+            , std::vector<numpy::detail::iter *> const & in_bound_iters
             , bool & error_flag
         )
         {
             // Create an argument data converter instance for each function
             // argument.
-            BOOST_PP_REPEAT(IN_ARITY, BOOST_NUMPY_DSTREAM_DEF_arg_converter, ~)
+            size_t iter_op_idx = MappingDefinition::out::arity;
+            BOOST_PP_REPEAT(FCT_ARITY, BOOST_NUMPY_DSTREAM_DEF_arg_converter, ~)
 
             // Create the result data converter instance for putting the
             // function result into the numpy array.
             return_to_core_shape_data_t result_converter(iter, out_core_shapes);
 
+            // An additional last iterator operand is the mask of the where
+            // argument. Masked-out elements are neither computed nor written.
+            int const mask_op_idx = iter_op_idx;
+            bool const is_masked = (mask_op_idx < iter.get_nop());
+
             do {
                 intptr_t size = iter.get_inner_loop_size();
+                if(is_masked && is_masked_chunk(iter, mask_op_idx, size)) {
+                    continue;
+                }
                 while(size--)
                 {
-                    if(! result_converter(
-                          f_caller.call(
-                                self
-                              , BOOST_PP_REPEAT(IN_ARITY, BOOST_NUMPY_DSTREAM_DEF__in_arr_value, ~)
+                    if(   (! is_masked || *iter.get_data(mask_op_idx))
+                       && ! result_converter(
+                              f_caller.call(
+                                    self
+                                  , BOOST_PP_REPEAT(FCT_ARITY, BOOST_NUMPY_DSTREAM_DEF__in_arr_value, ~)
+                              )
                           )
-                    ))
+                      )
                     {
                         error_flag = true;
                         return;
@@ -322,7 +723,7 @@ struct generalized_wiring_model_arity<IN_ARITY>
 #undef BOOST_NUMPY_DSTREAM_DEF_arg_converter
 #undef BOOST_NUMPY_DSTREAM_DEF_arg_converter_type
 
-#undef IN_ARITY
+#undef FCT_ARITY
 
 #endif // BOOST_PP_ITERATION_FLAGS() == 1
 
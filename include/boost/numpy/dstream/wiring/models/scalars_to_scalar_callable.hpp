@@ -37,6 +37,7 @@
 
 #include <boost/mpl/and.hpp>
 #include <boost/mpl/at.hpp>
+#include <boost/mpl/bool.hpp>
 #include <boost/mpl/bitor.hpp>
 #include <boost/mpl/equal_to.hpp>
 #include <boost/mpl/int.hpp>
@@ -108,6 +109,15 @@ struct scalars_to_scalar_callable_api
     BOOST_STATIC_CONSTANT(casting_t, casting = numpy::SAME_KIND_CASTING);
 
     BOOST_STATIC_CONSTANT(intptr_t, buffersize = 0);
+
+    // This wiring model accesses the input arrays by their fixed iterator
+    // operand index, so no input array can be bound as constant argument.
+    template <unsigned Idx>
+    struct in_arr_is_bindable
+    {
+        typedef boost::mpl::false_
+                type;
+    };
 };
 
 template <unsigned in_arity>
@@ -241,6 +251,7 @@ struct scalars_to_scalar_callable_arity<IN_ARITY>
             , numpy::detail::iter & iter
             , std::vector< std::vector<intptr_t> > const & out_core_shapes
             , std::vector< std::vector<intptr_t> > const & in_core_shapes
+            , std::vector<numpy::detail::iter *> const & in_bound_iters
             , bool & error_flag
         )
         {
@@ -306,6 +317,7 @@ struct scalars_to_scalar_callable_arity<IN_ARITY>
             , numpy::detail::iter & iter
             , std::vector< std::vector<intptr_t> > const & out_core_shapes
             , std::vector< std::vector<intptr_t> > const & in_core_shapes
+            , std::vector<numpy::detail::iter *> const & in_bound_iters
             , bool & error_flag
         )
         {
@@ -33,6 +33,7 @@
 
 #include <boost/mpl/and.hpp>
 #include <boost/mpl/at.hpp>
+#include <boost/mpl/bool.hpp>
 #include <boost/mpl/bitor.hpp>
 #include <boost/mpl/long.hpp>
 #include <boost/mpl/or.hpp>
@@ -100,6 +101,15 @@ struct scalars_to_vector_of_scalar_callable_api
     BOOST_STATIC_CONSTANT(casting_t, casting = numpy::SAME_KIND_CASTING);
 
     BOOST_STATIC_CONSTANT(intptr_t, buffersize = 0);
+
+    // This wiring model accesses the input arrays by their fixed iterator
+    // operand index, so no input array can be bound as constant argument.
+    template <unsigned Idx>
+    struct in_arr_is_bindable
+    {
+        typedef boost::mpl::false_
+                type;
+    };
 };
 
 template <unsigned out_arity, unsigned in_arity>
@@ -259,6 +269,7 @@ struct scalars_to_vector_of_scalar_callable_arity<OUT_ARITY, IN_ARITY>
             , numpy::detail::iter & iter
             , std::vector< std::vector<intptr_t> > const & out_core_shapes
             , std::vector< std::vector<intptr_t> > const & in_core_shapes
+            , std::vector<numpy::detail::iter *> const & in_bound_iters
             , bool & error_flag
         )
         {
@@ -345,6 +356,7 @@ struct scalars_to_vector_of_scalar_callable_arity<OUT_ARITY, IN_ARITY>
             , numpy::detail::iter & iter
             , std::vector< std::vector<intptr_t> > const & out_core_shapes
             , std::vector< std::vector<intptr_t> > const & in_core_shapes
+            , std::vector<numpy::detail::iter *> const & in_bound_iters
             , bool & error_flag
         )
         {
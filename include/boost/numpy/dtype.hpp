@@ -29,6 +29,7 @@
 #include <boost/python/list.hpp>
 #include <boost/python/tuple.hpp>
 
+#include <boost/numpy/float16.hpp>
 #include <boost/numpy/object_manager_traits.hpp>
 
 namespace boost {
@@ -54,6 +55,13 @@ class dtype : public python::object
      */
     static bool equivalent(dtype const & a, dtype const & b);
 
+    /**
+     *  @brief Returns true if values of the dtype \a from can be cast to
+     *         values of the dtype \a to without loss of information, i.e.
+     *         according to the "safe" casting rule of numpy.
+     */
+    static bool can_cast(dtype const & from, dtype const & to);
+
     /**
      *  @brief Register from-Python converters for NumPy's built-in array scalar
      *         types.
@@ -70,8 +78,9 @@ class dtype : public python::object
      *
      *  This is perhaps the most useful part of the numpy API: it returns the
      *  dtype object corresponding to a built-in C++ type. This should work for
-     *  any integer or floating point type supported by numpy, and will also
-     *  work for std::complex if sizeof(std::complex<T>) == 2*sizeof(T).
+     *  any integer or floating point type supported by numpy, including
+     *  boost::numpy::float16 for half precision, and will also work for
+     *  std::complex if sizeof(std::complex<T>) == 2*sizeof(T).
      *
      *  It can also be useful for users to add explicit specializations for
      *  POD structs that return field-based dtypes.
@@ -252,6 +261,12 @@ struct builtin_dtype<bool, true>
     static dtype get();
 };
 
+template <>
+struct builtin_dtype<float16, false>
+{
+    static dtype get();
+};
+
 template <>
 struct builtin_dtype<void, false>
 {
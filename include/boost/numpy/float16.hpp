@@ -0,0 +1,193 @@
+/**
+ * $Id$
+ *
+ * Copyright (C)
+ * 2014 - $Date$
+ *     Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * @file boost/numpy/float16.hpp
+ * @version $Revision$
+ * @date $Date$
+ * @author Martin Wolf <boostnumpy@martin-wolf.org>
+ * @brief This file defines the boost::numpy::float16 type, which is the C++
+ *        counterpart of the numpy.float16 (NPY_HALF) data type. It stores the
+ *        16 bits of an IEEE 754 half precision number and converts implicitly
+ *        to and from float, so arithmetic is done in single precision.
+ *
+ *        This file is distributed under the Boost Software License,
+ *        Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ *        http://www.boost.org/LICENSE_1_0.txt).
+ */
+#ifndef BOOST_NUMPY_FLOAT16_HPP_INCLUDED
+#define BOOST_NUMPY_FLOAT16_HPP_INCLUDED
+
+#include <stdint.h>
+
+#include <cstring>
+
+#include <boost/static_assert.hpp>
+
+namespace boost {
+namespace numpy {
+
+/**
+ *  @brief A half precision floating point number with the same memory layout
+ *         as numpy.float16. Conversions from float round to nearest even.
+ */
+class float16
+{
+  public:
+    float16()
+      : bits_(0)
+    {}
+
+    float16(float f)
+      : bits_(float_to_bits(f))
+    {}
+
+    inline
+    operator float() const
+    {
+        return bits_to_float(bits_);
+    }
+
+    // Compound assignments are done in single precision and the result is
+    // rounded once.
+    #define BOOST_NUMPY_FLOAT16_DEF(op)                                        \
+        inline                                                                 \
+        float16 &                                                              \
+        operator op##=(float rhs)                                              \
+        {                                                                      \
+            bits_ = float_to_bits(bits_to_float(bits_) op rhs);                \
+            return *this;                                                      \
+        }
+    BOOST_NUMPY_FLOAT16_DEF(+)
+    BOOST_NUMPY_FLOAT16_DEF(-)
+    BOOST_NUMPY_FLOAT16_DEF(*)
+    BOOST_NUMPY_FLOAT16_DEF(/)
+    #undef BOOST_NUMPY_FLOAT16_DEF
+
+    /**
+     *  @brief Returns the raw 16 bits of the half precision number.
+     */
+    inline
+    uint16_t
+    bits() const
+    {
+        return bits_;
+    }
+
+    /**
+     *  @brief Creates a float16 object from the raw 16 bits of a half
+     *         precision number.
+     */
+    static
+    float16
+    from_bits(uint16_t bits)
+    {
+        float16 h;
+        h.bits_ = bits;
+        return h;
+    }
+
+    static
+    uint16_t
+    float_to_bits(float f)
+    {
+        uint32_t x;
+        std::memcpy(&x, &f, sizeof(x));
+
+        uint16_t const sign = uint16_t((x >> 16) & 0x8000u);
+        uint32_t const absx = x & 0x7fffffffu;
+
+        // NaN and infinity. A NaN keeps its upper mantissa bits and stays a
+        // NaN.
+        if(absx >= 0x7f800000u)
+        {
+            return uint16_t(sign | 0x7c00u | (absx > 0x7f800000u ? (0x0200u | ((absx >> 13) & 0x03ffu)) : 0u));
+        }
+        // Too large for half precision, even after rounding.
+        if(absx >= 0x47800000u)
+        {
+            return uint16_t(sign | 0x7c00u);
+        }
+        // Subnormal half precision numbers, or zero.
+        if(absx < 0x38800000u)
+        {
+            if(absx < 0x33000000u)
+            {
+                return sign;
+            }
+            uint32_t const e     = absx >> 23;
+            uint32_t const m     = (absx & 0x007fffffu) | 0x00800000u;
+            uint32_t const shift = 126u - e;
+            uint32_t h           = m >> shift;
+            uint32_t const rem   = m & ((1u << shift) - 1u);
+            uint32_t const halfway = 1u << (shift - 1u);
+            if(rem > halfway || (rem == halfway && (h & 1u)))
+            {
+                ++h;
+            }
+            return uint16_t(sign | h);
+        }
+        // Normal numbers: rebias the exponent and round the mantissa. A carry
+        // out of the mantissa correctly increments the exponent, up to
+        // infinity.
+        uint32_t h = (absx - 0x38000000u) >> 13;
+        uint32_t const rem = absx & 0x1fffu;
+        if(rem > 0x1000u || (rem == 0x1000u && (h & 1u)))
+        {
+            ++h;
+        }
+        return uint16_t(sign | h);
+    }
+
+    static
+    float
+    bits_to_float(uint16_t bits)
+    {
+        uint32_t const sign = uint32_t(bits & 0x8000u) << 16;
+        uint32_t e          = (bits >> 10) & 0x1fu;
+        uint32_t m          = bits & 0x03ffu;
+        uint32_t x;
+
+        if(e == 0x1fu)
+        {
+            x = sign | 0x7f800000u | (m << 13);
+        }
+        else if(e != 0)
+        {
+            x = sign | ((e + 112u) << 23) | (m << 13);
+        }
+        else if(m == 0)
+        {
+            x = sign;
+        }
+        else
+        {
+            // Normalize the subnormal half precision number.
+            e = 113u;
+            while(!(m & 0x0400u))
+            {
+                m <<= 1;
+                --e;
+            }
+            x = sign | (e << 23) | ((m & 0x03ffu) << 13);
+        }
+
+        float f;
+        std::memcpy(&f, &x, sizeof(f));
+        return f;
+    }
+
+  protected:
+    uint16_t bits_;
+};
+
+BOOST_STATIC_ASSERT_MSG((sizeof(float16) == 2),
+    "The boost::numpy::float16 type must have the size of a numpy.float16.");
+
+}// namespace numpy
+}// namespace boost
+
+#endif // !BOOST_NUMPY_FLOAT16_HPP_INCLUDED
@@ -29,6 +29,10 @@
     #define BOOST_NUMPY_LIMIT_OUTPUT_ARITY 10
 #endif
 
+#ifndef BOOST_NUMPY_LIMIT_OVERLOADS
+    #define BOOST_NUMPY_LIMIT_OVERLOADS 8
+#endif
+
 // No changes below this line !!!
 //------------------------------------------------------------------------------
 //
@@ -82,7 +82,8 @@ struct as_std_vector<T, MPLVector, 1>
         inline static std_vector_t                                             \
         apply()                                                                \
         {                                                                      \
-            std_vector_t std_vector(n);                                        \
+            std_vector_t std_vector;                                           \
+            std_vector.reserve(n);                                             \
             BOOST_PP_REPEAT(n, BOOST_NUMPY_DEF, ~)                             \
             return std_vector;                                                 \
         }                                                                      \
@@ -0,0 +1,79 @@
+/**
+ * $Id$
+ *
+ * Copyright (C)
+ * 2014 - $Date$
+ *     Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \file    boost/numpy/mpl/is_fixed_size_array.hpp
+ * \version $Revision$
+ * \date    $Date$
+ * \author  Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \brief This file defines MPL templates for checking if a type T is a
+ *        fixed-size array type, i.e. a boost::array or a std::array (if
+ *        available), and for getting its compile-time size.
+ *
+ *        This file is distributed under the Boost Software License,
+ *        Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ *        http://www.boost.org/LICENSE_1_0.txt).
+ */
+#ifndef BOOST_NUMPY_MPL_IS_FIXED_SIZE_ARRAY_HPP_INCLUDED
+#define BOOST_NUMPY_MPL_IS_FIXED_SIZE_ARRAY_HPP_INCLUDED
+
+#include <cstddef>
+
+#include <boost/config.hpp>
+#include <boost/array.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/int.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_ARRAY)
+#include <array>
+#endif
+
+namespace boost {
+namespace numpy {
+namespace mpl {
+
+template <typename T>
+struct is_fixed_size_array
+  : boost::mpl::false_
+{};
+
+template <typename T, std::size_t N>
+struct is_fixed_size_array< boost::array<T, N> >
+  : boost::mpl::true_
+{};
+
+#if !defined(BOOST_NO_CXX11_HDR_ARRAY)
+template <typename T, std::size_t N>
+struct is_fixed_size_array< std::array<T, N> >
+  : boost::mpl::true_
+{};
+#endif
+
+/**
+ * The fixed_size_array_size template evaluates to the compile-time number of
+ * elements of the fixed-size array type T.
+ */
+template <typename T>
+struct fixed_size_array_size;
+
+template <typename T, std::size_t N>
+struct fixed_size_array_size< boost::array<T, N> >
+  : boost::mpl::int_<N>
+{};
+
+#if !defined(BOOST_NO_CXX11_HDR_ARRAY)
+template <typename T, std::size_t N>
+struct fixed_size_array_size< std::array<T, N> >
+  : boost::mpl::int_<N>
+{};
+#endif
+
+}// namespace mpl
+}// namespace numpy
+}// namespace boost
+
+#endif // ! BOOST_NUMPY_MPL_IS_FIXED_SIZE_ARRAY_HPP_INCLUDED
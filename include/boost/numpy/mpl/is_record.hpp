@@ -0,0 +1,50 @@
+/**
+ * $Id$
+ *
+ * Copyright (C)
+ * 2014 - $Date$
+ *     Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \file    boost/numpy/mpl/is_record.hpp
+ * \version $Revision$
+ * \date    $Date$
+ * \author  Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \brief This file defines a MPL template for checking if a type T is a
+ *        struct, which has been registered as record element type through the
+ *        BOOST_NUMPY_RECORD macro.
+ *
+ *        This file is distributed under the Boost Software License,
+ *        Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ *        http://www.boost.org/LICENSE_1_0.txt).
+ */
+#ifndef BOOST_NUMPY_MPL_IS_RECORD_HPP_INCLUDED
+#define BOOST_NUMPY_MPL_IS_RECORD_HPP_INCLUDED
+
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+
+namespace boost {
+namespace numpy {
+namespace mpl {
+
+namespace detail {
+
+// The is_record_impl template is specialized by the BOOST_NUMPY_RECORD macro.
+template <typename T>
+struct is_record_impl
+  : boost::mpl::false_
+{};
+
+}// namespace detail
+
+template <typename T>
+struct is_record
+  : detail::is_record_impl<typename remove_cv<T>::type>
+{};
+
+}// namespace mpl
+}// namespace numpy
+}// namespace boost
+
+#endif // ! BOOST_NUMPY_MPL_IS_RECORD_HPP_INCLUDED
@@ -0,0 +1,74 @@
+/**
+ * $Id$
+ *
+ * Copyright (C)
+ * 2014 - $Date$
+ *     Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \file    boost/numpy/mpl/is_scalar.hpp
+ * \version $Revision$
+ * \date    $Date$
+ * \author  Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \brief This file defines the boost::numpy::mpl::is_scalar template for
+ *        checking if a type T is a scalar element type of an ndarray. In
+ *        addition to the types for which boost::is_scalar is true, this
+ *        includes std::complex types, boost::numpy::float16, and structs
+ *        registered as record element types.
+ *
+ *        This file is distributed under the Boost Software License,
+ *        Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ *        http://www.boost.org/LICENSE_1_0.txt).
+ */
+#ifndef BOOST_NUMPY_MPL_IS_SCALAR_HPP_INCLUDED
+#define BOOST_NUMPY_MPL_IS_SCALAR_HPP_INCLUDED
+
+#include <complex>
+
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/is_scalar.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+
+#include <boost/numpy/float16.hpp>
+#include <boost/numpy/mpl/is_record.hpp>
+
+namespace boost {
+namespace numpy {
+namespace mpl {
+
+namespace detail {
+
+template <typename T>
+struct is_std_complex_impl
+  : boost::mpl::false_
+{};
+
+template <typename T>
+struct is_std_complex_impl< std::complex<T> >
+  : boost::mpl::true_
+{};
+
+}// namespace detail
+
+template <typename T>
+struct is_std_complex
+  : detail::is_std_complex_impl<typename remove_cv<T>::type>
+{};
+
+template <typename T>
+struct is_float16
+  : is_same<typename remove_cv<T>::type, numpy::float16>
+{};
+
+template <typename T>
+struct is_scalar
+  : boost::mpl::or_< boost::is_scalar<T>, is_std_complex<T>, is_float16<T>, is_record<T> >::type
+{};
+
+}// namespace mpl
+}// namespace numpy
+}// namespace boost
+
+#endif // ! BOOST_NUMPY_MPL_IS_SCALAR_HPP_INCLUDED
@@ -31,6 +31,7 @@
 
 #include <boost/numpy/mpl/has_allocator_type.hpp>
 #include <boost/numpy/mpl/has_value_type.hpp>
+#include <boost/numpy/mpl/is_scalar.hpp>
 
 namespace boost {
 namespace numpy {
@@ -53,7 +54,7 @@ template <class T>
 struct is_std_vector_of_scalar_impl<T, true>
 {
     typedef typename boost::mpl::if_<
-                  typename is_scalar<typename remove_reference<typename T::value_type>::type>::type
+                  typename numpy::mpl::is_scalar<typename remove_reference<typename T::value_type>::type>::type
                 , typename boost::mpl::if_<
                         typename is_same< T, std::vector<typename T::value_type, typename T::allocator_type> >::type
                       , boost::mpl::true_
@@ -0,0 +1,121 @@
+/**
+ * $Id$
+ *
+ * Copyright (C)
+ * 2014 - $Date$
+ *     Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \file    boost/numpy/mpl/is_tuple.hpp
+ * \version $Revision$
+ * \date    $Date$
+ * \author  Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \brief This file defines MPL templates for checking if a type T is a tuple
+ *        type, i.e. a boost::tuple or a std::tuple (if available), and for
+ *        accessing its size and elements in a uniform way.
+ *
+ *        This file is distributed under the Boost Software License,
+ *        Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ *        http://www.boost.org/LICENSE_1_0.txt).
+ */
+#ifndef BOOST_NUMPY_MPL_IS_TUPLE_HPP_INCLUDED
+#define BOOST_NUMPY_MPL_IS_TUPLE_HPP_INCLUDED
+
+#include <boost/config.hpp>
+#include <boost/preprocessor/repetition/enum_params.hpp>
+
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/tuple/tuple.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_TUPLE) && !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+#define BOOST_NUMPY_HAS_STD_TUPLE
+#include <tuple>
+#endif
+
+namespace boost {
+namespace numpy {
+namespace mpl {
+
+template <typename T>
+struct is_tuple
+  : boost::mpl::false_
+{};
+
+template <BOOST_PP_ENUM_PARAMS(10, typename T)>
+struct is_tuple< boost::tuples::tuple<BOOST_PP_ENUM_PARAMS(10, T)> >
+  : boost::mpl::true_
+{};
+
+#ifdef BOOST_NUMPY_HAS_STD_TUPLE
+template <typename... T>
+struct is_tuple< std::tuple<T...> >
+  : boost::mpl::true_
+{};
+#endif
+
+/**
+ * The tuple_size template evaluates to the number of elements of the tuple
+ * type T.
+ */
+template <typename T>
+struct tuple_size;
+
+template <BOOST_PP_ENUM_PARAMS(10, typename T)>
+struct tuple_size< boost::tuples::tuple<BOOST_PP_ENUM_PARAMS(10, T)> >
+  : boost::mpl::int_< boost::tuples::length< boost::tuples::tuple<BOOST_PP_ENUM_PARAMS(10, T)> >::value >
+{};
+
+#ifdef BOOST_NUMPY_HAS_STD_TUPLE
+template <typename... T>
+struct tuple_size< std::tuple<T...> >
+  : boost::mpl::int_< sizeof...(T) >
+{};
+#endif
+
+/**
+ * The tuple_element template defines the type of the idx'th element of the
+ * tuple type T and provides the static get function to access it.
+ */
+template <unsigned idx, typename T>
+struct tuple_element;
+
+template <unsigned idx, BOOST_PP_ENUM_PARAMS(10, typename T)>
+struct tuple_element< idx, boost::tuples::tuple<BOOST_PP_ENUM_PARAMS(10, T)> >
+{
+    typedef boost::tuples::tuple<BOOST_PP_ENUM_PARAMS(10, T)>
+            tuple_t;
+    typedef typename boost::tuples::element<idx, tuple_t>::type
+            type;
+
+    static
+    type const &
+    get(tuple_t const & t)
+    {
+        return boost::tuples::get<idx>(t);
+    }
+};
+
+#ifdef BOOST_NUMPY_HAS_STD_TUPLE
+template <unsigned idx, typename... T>
+struct tuple_element< idx, std::tuple<T...> >
+{
+    typedef std::tuple<T...>
+            tuple_t;
+    typedef typename std::tuple_element<idx, tuple_t>::type
+            type;
+
+    static
+    type const &
+    get(tuple_t const & t)
+    {
+        return std::get<idx>(t);
+    }
+};
+#endif
+
+}// namespace mpl
+}// namespace numpy
+}// namespace boost
+
+#endif // ! BOOST_NUMPY_MPL_IS_TUPLE_HPP_INCLUDED
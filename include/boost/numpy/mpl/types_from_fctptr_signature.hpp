@@ -53,6 +53,7 @@
 
 #include <boost/numpy/limits.hpp>
 #include <boost/numpy/mpl/unspecified.hpp>
+#include <boost/numpy/mpl/is_scalar.hpp>
 #include <boost/numpy/mpl/is_std_vector_of_scalar.hpp>
 
 namespace boost {
@@ -81,7 +82,7 @@ struct all_fct_args_are_scalars_arity;
 template <class FTypes>
 struct all_fct_args_are_scalars_arity<1, FTypes>
 {
-    typedef boost::is_scalar<typename FTypes::arg_type0>
+    typedef numpy::mpl::is_scalar<typename FTypes::arg_type0>
             type;
 };
 
@@ -135,7 +136,7 @@ struct all_fct_args_are_scalars
 template <class FTypes>
 struct fct_return_is_scalar
 {
-    typedef boost::is_scalar<typename FTypes::return_type>
+    typedef numpy::mpl::is_scalar<typename FTypes::return_type>
             type;
 };
 
@@ -214,7 +215,7 @@ struct all_fct_args_are_scalars_arity<N, FTypes>
     // to construct a sequence of boost::mpl::and_<.,.> with always, two
     // arguments.
     #define BOOST_NUMPY_DEF_is_scalar(n) \
-        boost::is_scalar<typename FTypes:: BOOST_PP_CAT(arg_type,n) >
+        numpy::mpl::is_scalar<typename FTypes:: BOOST_PP_CAT(arg_type,n) >
     #define BOOST_NUMPY_DEF_pre_and(z, n, data) \
         typename boost::mpl::and_<
     #define BOOST_NUMPY_DEF_post_and(z, n, data) \
@@ -305,6 +305,14 @@ class ndarray : public python::object
     ndarray
     transpose() const;
 
+    //__________________________________________________________________________
+    /**
+     * @brief Permute the dimensions of the array. The i-th dimension of the
+     *     returned array is the axes[i]-th dimension of this array.
+     */
+    ndarray
+    transpose(std::vector<int> const & axes) const;
+
     //__________________________________________________________________________
     /**
      * @brief Eliminate any unit-sized dimensions.
@@ -0,0 +1,139 @@
+/**
+ * $Id$
+ *
+ * Copyright (C)
+ * 2014 - $Date$
+ *     Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \file    boost/numpy/record.hpp
+ * \version $Revision$
+ * \date    $Date$
+ * \author  Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \brief This file defines the BOOST_NUMPY_RECORD macro, which registers a
+ *        plain C++ struct as record element type of ndarrays. The structured
+ *        data type of the struct is built from its field names, types, and
+ *        offsets once, and is returned by dtype::get_builtin<T>() afterwards.
+ *        A registered struct is a scalar element type, so it can be used as
+ *        argument and return type of generalized universal functions.
+ *
+ *        This file is distributed under the Boost Software License,
+ *        Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ *        http://www.boost.org/LICENSE_1_0.txt).
+ */
+#ifndef BOOST_NUMPY_RECORD_HPP_INCLUDED
+#define BOOST_NUMPY_RECORD_HPP_INCLUDED
+
+#include <stdint.h>
+
+#include <cstddef>
+
+#include <boost/mpl/bool.hpp>
+#include <boost/preprocessor/seq/for_each.hpp>
+#include <boost/preprocessor/stringize.hpp>
+
+#include <boost/python/dict.hpp>
+#include <boost/python/list.hpp>
+
+#include <boost/numpy/dtype.hpp>
+#include <boost/numpy/mpl/is_record.hpp>
+
+namespace boost {
+namespace numpy {
+namespace detail {
+
+/**
+ * The record_dtype_builder class collects the names, data types, and byte
+ * offsets of the fields of a struct and builds its aligned structured data
+ * type.
+ */
+class record_dtype_builder
+{
+  public:
+    explicit
+    record_dtype_builder(intptr_t itemsize)
+      : itemsize_(itemsize)
+    {}
+
+    template <class C, class M>
+    void
+    add_field(char const * name, M C::*, intptr_t offset)
+    {
+        names_.append(name);
+        formats_.append(dtype::get_builtin<M>());
+        offsets_.append(offset);
+    }
+
+    dtype
+    build() const
+    {
+        python::dict spec;
+        spec["names"]    = names_;
+        spec["formats"]  = formats_;
+        spec["offsets"]  = offsets_;
+        spec["itemsize"] = itemsize_;
+        return dtype(spec, true);
+    }
+
+  protected:
+    intptr_t     itemsize_;
+    python::list names_;
+    python::list formats_;
+    python::list offsets_;
+};
+
+}// namespace detail
+}// namespace numpy
+}// namespace boost
+
+#define BOOST_NUMPY_RECORD_add_field(r, T, field)                              \
+    builder.add_field(BOOST_PP_STRINGIZE(field), &T::field, offsetof(T, field));
+
+/**
+ * The BOOST_NUMPY_RECORD macro registers the struct T with the fields given
+ * as Boost.Preprocessor sequence FIELDS as record element type, e.g.
+ *
+ *     struct particle { double x; double y; int32_t id; };
+ *     BOOST_NUMPY_RECORD(particle, (x)(y)(id))
+ *
+ * The field types must be element types themselves, e.g. other registered
+ * structs. The macro must be used in the global namespace. The data type is
+ * built on the first call of dtype::get_builtin<T>(), which requires the
+ * Python GIL, and is kept until the program ends.
+ */
+#define BOOST_NUMPY_RECORD(T, FIELDS)                                          \
+    namespace boost {                                                          \
+    namespace numpy {                                                          \
+    namespace mpl {                                                            \
+    namespace detail {                                                         \
+    template <>                                                                \
+    struct is_record_impl< T >                                                 \
+      : boost::mpl::true_                                                      \
+    {};                                                                        \
+    }/* namespace detail */                                                    \
+    }/* namespace mpl */                                                       \
+    namespace detail {                                                         \
+    template <>                                                                \
+    struct builtin_dtype< T, false >                                           \
+    {                                                                          \
+        static dtype get()                                                     \
+        {                                                                      \
+            static dtype const * dt = NULL;                                    \
+            if(dt == NULL)                                                     \
+            {                                                                  \
+                record_dtype_builder builder(sizeof(T));                       \
+                BOOST_PP_SEQ_FOR_EACH(BOOST_NUMPY_RECORD_add_field, T, FIELDS) \
+                dt = new dtype(builder.build());                               \
+            }                                                                  \
+            return *dt;                                                        \
+        }                                                                      \
+    };                                                                         \
+    template <>                                                                \
+    struct builtin_dtype< T const, false >                                     \
+      : builtin_dtype< T, false >                                              \
+    {};                                                                        \
+    }/* namespace detail */                                                    \
+    }/* namespace numpy */                                                     \
+    }/* namespace boost */
+
+#endif // !BOOST_NUMPY_RECORD_HPP_INCLUDED
@@ -37,12 +37,63 @@ namespace detail {
     (4, (1, BOOST_NUMPY_LIMIT_INPUT_AND_OUTPUT_ARITY, <boost/numpy/detail/iter.hpp>, 2))
 #include BOOST_PP_ITERATE()
 
+//______________________________________________________________________________
+iter::
+iter(
+      iter_flags_t iter_flags
+    , order_t      order
+    , casting_t    casting
+    , int          n_iter_axes
+    , intptr_t *   itershape
+    , intptr_t     buffersize
+    , std::vector<iter_operand const *> const & ops
+)
+{
+    npy_intp const nop = ops.size();
+
+    std::vector<PyArrayObject*> op(nop);
+    std::vector<npy_uint32>     op_flags(nop);
+    std::vector<PyArray_Descr*> op_dtypes(nop);
+    std::vector<int*>           op_axes(nop);
+    for(npy_intp i=0; i<nop; ++i)
+    {
+        op[i]        = reinterpret_cast<PyArrayObject*>(ops[i]->ndarray_.ptr());
+        op_flags[i]  = ops[i]->flags_;
+        op_dtypes[i] = reinterpret_cast<PyArray_Descr*>(ops[i]->dtype_.ptr());
+        op_axes[i]   = ops[i]->broadcasting_rules_;
+    }
+
+    BOOST_NUMPY_LOG("itershape: " << c_array_to_string(itershape, n_iter_axes))
+
+    npyiter_ = NpyIter_AdvancedNew(
+          nop
+        , &op.front()
+        , iter_flags
+        , NPY_ORDER(order)
+        , NPY_CASTING(casting)
+        , &op_flags.front()
+        , &op_dtypes.front()
+        , n_iter_axes
+        , &op_axes.front()
+        , itershape
+        , buffersize
+    );
+    if(npyiter_ == NULL)
+    {
+        python::throw_error_already_set();
+    }
+}
+
 //______________________________________________________________________________
 iter::
 ~iter()
 {
     assert(npyiter_);
-    if(NpyIter_Deallocate(npyiter_) != NPY_SUCCEED)
+    // Note: NpyIter_Deallocate reports a failure if a Python error is already
+    //       set. In that case the iterator is destructed during stack
+    //       unwinding, and we must not throw again.
+    bool const error_pending = (PyErr_Occurred() != NULL);
+    if(NpyIter_Deallocate(npyiter_) != NPY_SUCCEED && !error_pending)
     {
         PyErr_SetString(PyExc_RuntimeError,
             "The NpyIter iterator object could not be deallocated!");
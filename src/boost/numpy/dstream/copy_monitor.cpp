@@ -0,0 +1,110 @@
+/**
+ * $Id$
+ *
+ * Copyright (C)
+ * 2014 - $Date$
+ *     Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \file    boost/numpy/dstream/copy_monitor.cpp
+ * \version $Revision$
+ * \date    $Date$
+ * \author  Martin Wolf <boostnumpy@martin-wolf.org>
+ *
+ * \brief This file implements the boost::numpy::dstream::copy_monitor class.
+ *
+ *        This file is distributed under the Boost Software License,
+ *        Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ *        http://www.boost.org/LICENSE_1_0.txt).
+ */
+#include <sstream>
+
+#include <boost/python.hpp>
+
+#include <boost/numpy/detail/logging.hpp>
+#include <boost/numpy/dstream/copy_monitor.hpp>
+
+namespace boost {
+namespace numpy {
+namespace dstream {
+
+namespace {
+
+copy_mode_t copy_mode_ = COPY_ALLOWED;
+intptr_t    n_copies_  = 0;
+intptr_t    n_bytes_   = 0;
+
+}// namespace
+
+//______________________________________________________________________________
+void
+copy_monitor::
+set_mode(copy_mode_t mode)
+{
+    copy_mode_ = mode;
+}
+
+//______________________________________________________________________________
+copy_mode_t
+copy_monitor::
+get_mode()
+{
+    return copy_mode_;
+}
+
+//______________________________________________________________________________
+intptr_t
+copy_monitor::
+get_n_copies()
+{
+    return n_copies_;
+}
+
+//______________________________________________________________________________
+intptr_t
+copy_monitor::
+get_n_bytes()
+{
+    return n_bytes_;
+}
+
+//______________________________________________________________________________
+void
+copy_monitor::
+reset()
+{
+    n_copies_ = 0;
+    n_bytes_  = 0;
+}
+
+//______________________________________________________________________________
+void
+copy_monitor::
+record(unsigned in_arr_idx, char const * reason, intptr_t nbytes)
+{
+    std::ostringstream msg;
+    msg << "The input array " << in_arr_idx << " is copied ("
+        << reason << ", " << nbytes << " bytes).";
+    BOOST_NUMPY_LOG(msg.str())
+
+    if(copy_mode_ == COPY_NEVER)
+    {
+        msg << " Copies are not allowed by the copy mode.";
+        PyErr_SetString(PyExc_RuntimeError, msg.str().c_str());
+        python::throw_error_already_set();
+    }
+
+    ++n_copies_;
+    n_bytes_ += nbytes;
+
+    if(copy_mode_ == COPY_WARN)
+    {
+        if(PyErr_WarnEx(PyExc_RuntimeWarning, msg.str().c_str(), 1) == -1)
+        {
+            python::throw_error_already_set();
+        }
+    }
+}
+
+}// namespace dstream
+}// namespace numpy
+}// namespace boost
@@ -240,6 +240,17 @@ equivalent(dtype const & a, dtype const & b)
     );
 }
 
+//______________________________________________________________________________
+bool
+dtype::
+can_cast(dtype const & from, dtype const & to)
+{
+    return PyArray_CanCastTo(
+        reinterpret_cast<PyArray_Descr*>(from.ptr()),
+        reinterpret_cast<PyArray_Descr*>(to.ptr())
+    );
+}
+
 namespace detail {
 
 #define DTYPE_FROM_CODE(code) \
@@ -253,6 +264,14 @@ get()
     return DTYPE_FROM_CODE(NPY_BOOL);
 }
 
+//______________________________________________________________________________
+dtype
+builtin_dtype<float16, false>::
+get()
+{
+    return DTYPE_FROM_CODE(NPY_HALF);
+}
+
 //______________________________________________________________________________
 dtype
 builtin_dtype<void, false>::
@@ -430,6 +449,7 @@ dtype::
 register_scalar_converters()
 {
     boost_numpy_array_scalar_converter< bool >::declare();
+    boost_numpy_array_scalar_converter< float16 >::declare();
     boost_numpy_array_scalar_converter< float >::declare();
     boost_numpy_array_scalar_converter< double >::declare();
 
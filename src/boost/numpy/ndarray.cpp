@@ -153,7 +153,7 @@ from_data_impl(
         flags = flags | ndarray::F_CONTIGUOUS;
     if(is_aligned(strides, itemsize))
         flags = flags | ndarray::ALIGNED;
-    if( set_owndata_flag && ( (!owner) || (owner && (*owner) == python::object()) ) )
+    if( set_owndata_flag && ( (!owner) || (owner && owner->is_none()) ) )
         flags = flags | ndarray::OWNDATA;
 
     ndarray arr(python::detail::new_reference(
@@ -166,7 +166,7 @@ from_data_impl(
             data,
             bn_ndarray_flags_to_npy_array_flags(flags),
             NULL)));
-    if(owner && (*owner) != python::object()) {
+    if(owner && ! owner->is_none()) {
         arr.set_base(*owner);
     }
     return arr;
@@ -403,6 +403,17 @@ transpose() const
         PyArray_Transpose(reinterpret_cast<PyArrayObject*>(this->ptr()), NULL)));
 }
 
+//______________________________________________________________________________
+ndarray
+ndarray::
+transpose(std::vector<int> const & axes) const
+{
+    std::vector<npy_intp> perm(axes.begin(), axes.end());
+    PyArray_Dims permute = { (perm.empty() ? NULL : &perm.front()), int(perm.size()) };
+    return ndarray(python::detail::new_reference(
+        PyArray_Transpose(reinterpret_cast<PyArrayObject*>(this->ptr()), &permute)));
+}
+
 //______________________________________________________________________________
 ndarray
 ndarray::
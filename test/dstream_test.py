@@ -12,7 +12,9 @@
 # http://www.boost.org/LICENSE_1_0.txt).
 #
 import dstream_test_module
+import functools
 import unittest
+import warnings
 import numpy as np
 
 class TestDstream(unittest.TestCase):
@@ -109,6 +111,696 @@ class TestDstream(unittest.TestCase):
         o_r = np.hstack((a1.reshape((self.N,1)), a2.reshape((self.N,1))))
         self.assertTrue((o == o_r).all())
 
+    def test_fixed_size_array_and_tuple_returns(self):
+        a1 = np.arange(0,self.N, dtype=np.float64)
+        a2 = np.arange(0,self.N, dtype=np.float64)*3.42
+
+        r = np.vstack((a1, a2, a1*a2)).T
+
+        o = dstream_test_module.binary_to_arrayT__double(a1, a2)
+        self.assertTrue(o.shape == (self.N,3))
+        self.assertTrue((o == r).all())
+
+        o = dstream_test_module.binary_to_arrayT__allow_threads__double(a1, a2, nthreads=3)
+        self.assertTrue((o == r).all())
+
+        o = np.empty((self.N,3), dtype=np.float64)
+        dstream_test_module.binary_to_arrayT__double(a1, a2, out=o)
+        self.assertTrue((o == r).all())
+
+        t = dstream_test_module.binary_to_arrayT__tuple__double(a1, a2)
+        self.assertTrue(len(t) == 3)
+        self.assertTrue((t[0] == a1).all())
+        self.assertTrue((t[1] == a2).all())
+        self.assertTrue((t[2] == a1*a2).all())
+
+        o = dstream_test_module.binary_to_arrayT_2x2__double(a1, a2)
+        self.assertTrue(o.shape == (self.N,2,2))
+        self.assertTrue((o[:,0,0] == a1).all())
+        self.assertTrue((o[:,0,1] == a2).all())
+        self.assertTrue((o[:,1,0] == -a2).all())
+        self.assertTrue((o[:,1,1] == a1).all())
+
+        (p, l) = dstream_test_module.binary_to_tupleT_int__double(a1, a2)
+        self.assertTrue(p.dtype == np.float64)
+        self.assertTrue(l.dtype == np.dtype(np.intc))
+        self.assertTrue((p == a1*a2).all())
+        self.assertTrue((l == (a1 < a2)).all())
+
+        (p, l) = dstream_test_module.binary_to_tupleT_int__allow_threads__double(a1, a2, nthreads=3)
+        self.assertTrue((p == a1*a2).all())
+        self.assertTrue((l == (a1 < a2)).all())
+
+        if hasattr(dstream_test_module, 'binary_to_std_arrayT__double'):
+            o = dstream_test_module.binary_to_std_arrayT__double(a1, a2)
+            self.assertTrue((o == r).all())
+
+            (p, l, e) = dstream_test_module.binary_to_std_tupleT_int_bool__double(a1, a2)
+            self.assertTrue(e.dtype == np.bool_)
+            self.assertTrue((p == a1*a2).all())
+            self.assertTrue((l == (a1 < a2)).all())
+            self.assertTrue((e == (a1 == a2)).all())
+
+    def test_fixed_size_core_dimensions(self):
+        a1 = np.arange(0,self.N*3, dtype=np.float64).reshape((self.N,3))
+        a2 = np.arange(0,self.N*3, dtype=np.float64).reshape((self.N,3))[:,::-1]*3.42
+
+        r = np.cross(a1, a2)
+
+        o = dstream_test_module.arrayT_cross__double(a1, a2)
+        self.assertTrue(o.shape == (self.N,3))
+        self.assertTrue((o == r).all())
+
+        o = dstream_test_module.arrayT_cross__allow_threads__double(a1, a2, nthreads=3)
+        self.assertTrue((o == r).all())
+
+        self.assertRaises(ValueError, dstream_test_module.arrayT_cross__double, a1[:,:2], a2[:,:2])
+
+        m = np.arange(0,self.N*9, dtype=np.float64).reshape((self.N,3,3))
+        r = m[:,0,0] + m[:,1,1] + m[:,2,2]
+        o = dstream_test_module.arrayT_3x3_trace__double(m)
+        self.assertTrue((o == r).all())
+
+        o = dstream_test_module.arrayT_3x3_trace__double(m.transpose((0,2,1)))
+        self.assertTrue((o == r).all())
+
+        r = (a1*a2).sum(axis=1)
+        o = dstream_test_module.vectorT_dot__fixed3__double(a1, a2)
+        self.assertTrue((o == r).all())
+
+    def test_core_dimensions(self):
+        a1 = np.arange(0,self.N*3, dtype=np.float64).reshape((self.N,3))
+        a2 = np.arange(0,self.N*3, dtype=np.float64).reshape((self.N,3))*3.42
+
+        r = (a1*a2).sum(axis=1)
+
+        o = dstream_test_module.vectorT_dot__double(a1, a2)
+        self.assertTrue((o == r).all())
+
+        o = dstream_test_module.vectorT_dot__allow_threads__double(a1, a2, nthreads=3)
+        self.assertTrue((o == r).all())
+
+        # Broadcast the core dimension of the second argument over the loop
+        # dimension.
+        b = np.array([1., 2., 3.])
+        r = (a1*b).sum(axis=1)
+
+        o = dstream_test_module.vectorT_dot__double(a1, b)
+        self.assertTrue((o == r).all())
+
+        o = dstream_test_module.vectorT_dot__double(b, a1)
+        self.assertTrue((o == r).all())
+
+        o = dstream_test_module.vectorT_dot__allow_threads__double(a1, b, nthreads=3)
+        self.assertTrue((o == r).all())
+
+        # Arguments passed by const reference.
+        r = (a1*a2).sum(axis=1)
+
+        o = dstream_test_module.vectorT_cref_dot__double(a1, a2)
+        self.assertTrue((o == r).all())
+
+        o = dstream_test_module.vectorT_cref_dot__allow_threads__double(a1, a2, nthreads=3)
+        self.assertTrue((o == r).all())
+
+        o = dstream_test_module.vectorT_cref_dot__double(np.asfortranarray(a1), a2)
+        self.assertTrue((o == r).all())
+
+        m = np.arange(0,self.N*6, dtype=np.float64).reshape((self.N,2,3))
+        o = dstream_test_module.vector2dT_cref_sum__double(m)
+        self.assertTrue((o == m.sum(axis=(1,2))).all())
+
+        o = dstream_test_module.vector2dT_cref_sum__double(m.transpose((0,2,1)))
+        self.assertTrue((o == m.sum(axis=(1,2))).all())
+
+        # The argument vectors are filled in place, i.e. their storage is
+        # reused for all loop elements after the first one.
+        o = dstream_test_module.vector2dT_cref_storage_reused__double(m)
+        self.assertTrue((o[1:] == 1).all())
+
+        o = dstream_test_module.vector2dT_cref_storage_reused__double(m.transpose((0,2,1)))
+        self.assertTrue((o[1:] == 1).all())
+
+        # Non-contiguous core dimensions.
+        r = (a1*a2).sum(axis=1)
+
+        o = dstream_test_module.vectorT_dot__double(np.asfortranarray(a1), a2)
+        self.assertTrue((o == r).all())
+
+        r = (a1[:,::-1]*a2[:,::-1]).sum(axis=1)
+        o = dstream_test_module.vectorT_dot__double(a1[:,::-1], a2[:,::-1])
+        self.assertTrue((o == r).all())
+
+        o = np.empty((2, self.N), dtype=np.float64).T
+        dstream_test_module.binary_to_vectorT__array__double(a1[:,0], a2[:,0], out=o)
+        self.assertTrue((o[:,0] == a1[:,0]).all())
+        self.assertTrue((o[:,1] == a2[:,0]).all())
+
+        # A later element returning a longer vector must not write beyond its
+        # output core dimension.
+        v = np.arange(0,20, dtype=np.float64)
+        o = np.full((21, 2), -1, dtype=np.float64)
+        self.assertRaises(RuntimeError, dstream_test_module.unary_to_vectorT_ragged__array__double, v, out=o[:20])
+        self.assertTrue((o[:10] == v[:10].reshape((10,1))).all())
+        self.assertTrue((o[20] == -1).all())
+
+    def test_array_view_arguments(self):
+        a1 = np.arange(0,self.N*3, dtype=np.float64).reshape((self.N,3))
+        a2 = np.arange(0,self.N*3, dtype=np.float64).reshape((self.N,3))*3.42
+
+        r = (a1*a2).sum(axis=1)
+
+        o = dstream_test_module.viewT_dot__double(a1, a2)
+        self.assertTrue((o == r).all())
+
+        o = dstream_test_module.viewT_dot__allow_threads__double(a1, a2, nthreads=3)
+        self.assertTrue((o == r).all())
+
+        # Non-contiguous core dimensions.
+        a3 = np.arange(0,self.N*6, dtype=np.float64).reshape((self.N,6))[:,::2]
+        r = (a3*a2).sum(axis=1)
+        o = dstream_test_module.viewT_dot__double(a3, a2)
+        self.assertTrue((o == r).all())
+
+        m = np.arange(0,self.N*9, dtype=np.float64).reshape((self.N,3,3))
+        r = np.trace(m, axis1=1, axis2=2)
+        o = dstream_test_module.viewT_trace__double(m)
+        self.assertTrue((o == r).all())
+
+        mt = m.transpose((0,2,1))
+        o = dstream_test_module.viewT_trace__double(mt)
+        self.assertTrue((o == r).all())
+
+    def test_output_arguments(self):
+        a1 = np.arange(0,self.N, dtype=np.float64)
+        a2 = np.arange(0,self.N, dtype=np.float64)*3.42
+
+        (s, d) = dstream_test_module.binary_to_T_sum_and_diff__double(a1, a2)
+        self.assertTrue((s == a1+a2).all())
+        self.assertTrue((d == a1-a2).all())
+
+        (s, d) = dstream_test_module.binary_to_T_sum_and_diff__allow_threads__double(a1, a2, nthreads=3)
+        self.assertTrue((s == a1+a2).all())
+        self.assertTrue((d == a1-a2).all())
+
+        t = (np.empty((self.N,), dtype=np.float64),
+             np.empty((self.N,), dtype=np.float64))
+        dstream_test_module.binary_to_T_sum_and_diff__double(a1, a2, out=t)
+        self.assertTrue((t[0] == a1+a2).all())
+        self.assertTrue((t[1] == a1-a2).all())
+
+        a = np.arange(0,self.N*3, dtype=np.float64).reshape((self.N,3))
+
+        r = a*2.5
+
+        o = dstream_test_module.viewT_scale__double(a, 2.5)
+        self.assertTrue(o.shape == r.shape)
+        self.assertTrue((o == r).all())
+
+        o = dstream_test_module.viewT_scale__allow_threads__double(a, 2.5, nthreads=3)
+        self.assertTrue((o == r).all())
+
+        o = np.empty((self.N,3), dtype=np.float64)
+        dstream_test_module.viewT_scale__double(a, 2.5, out=o)
+        self.assertTrue((o == r).all())
+
+        b = np.array([1., 2.])
+        r = a[:,:,np.newaxis]*b
+        o = dstream_test_module.viewT_outer__double(a, b)
+        self.assertTrue(o.shape == (self.N,3,2))
+        self.assertTrue((o == r).all())
+
+    def test_output_dtype(self):
+        m = dstream_test_module
+        a1 = np.arange(0,self.N, dtype=np.float64)*0.1
+        a2 = np.arange(0,self.N, dtype=np.float64)*3.42
+
+        o = m.binary_to_T_mult__double(a1, a2, dtype=np.float32)
+        self.assertTrue(o.dtype == np.float32)
+        self.assertTrue((o == (a1*a2).astype(np.float32)).all())
+
+        o = m.binary_to_T_mult__allow_threads__double(a1, a2, nthreads=3, dtype='f4')
+        self.assertTrue(o.dtype == np.float32)
+        self.assertTrue((o == (a1*a2).astype(np.float32)).all())
+
+        # A data type for each output array.
+        (s, d) = m.binary_to_T_sum_and_diff__double(a1, a2, dtype=(np.float32, None))
+        self.assertTrue(s.dtype == np.float32 and d.dtype == np.float64)
+        self.assertTrue((s == (a1+a2).astype(np.float32)).all())
+        self.assertTrue((d == a1-a2).all())
+
+        # A provided output array is written in its own data type.
+        o = np.empty((self.N,), dtype=np.float32)
+        m.binary_to_T_mult__double(a1, a2, out=o)
+        self.assertTrue((o == (a1*a2).astype(np.float32)).all())
+
+        # Output arrays with core dimensions cannot be cast.
+        self.assertRaises(ValueError, m.binary_to_vectorT__array__double, a1, a2, dtype=np.float32)
+        self.assertRaises(ValueError, m.binary_to_T_sum_and_diff__double, a1, a2, dtype=(np.float32,))
+
+    def test_output_order(self):
+        m = dstream_test_module
+        c = np.arange(0,1200, dtype=np.float64).reshape((40,30))
+        f = np.asfortranarray(c)
+
+        # By default, the output keeps the memory order of the inputs.
+        o = m.binary_to_T_mult__double(f, f)
+        self.assertTrue(o.flags.f_contiguous and not o.flags.c_contiguous)
+        self.assertTrue((o == c*c).all())
+
+        o = m.binary_to_T_mult__double(c.T, 2.0)
+        self.assertTrue(o.flags.f_contiguous)
+        self.assertTrue((o == 2*c.T).all())
+
+        o = m.binary_to_T_mult__allow_threads__double(f, f, nthreads=3, order='C')
+        self.assertTrue(o.flags.c_contiguous)
+        self.assertTrue((o == c*c).all())
+
+        o = m.binary_to_T_mult__double(c, c, order='F')
+        self.assertTrue(o.flags.f_contiguous)
+        self.assertTrue((o == c*c).all())
+
+        # Core dimensions stay the innermost dimensions.
+        o = m.binary_to_vectorT__array__double(f, f)
+        self.assertTrue(o.shape == (40,30,2))
+        self.assertTrue(o.transpose((1,0,2)).flags.c_contiguous)
+        self.assertTrue((o[:,:,0] == c).all())
+
+        self.assertRaises(ValueError, m.binary_to_T_mult__double, c, c, order='X')
+
+    def test_where(self):
+        m = dstream_test_module
+        a1 = np.arange(0,self.N, dtype=np.float64)
+        a2 = np.arange(0,self.N, dtype=np.float64)*0.5
+        w = (np.arange(0,self.N) % 3 == 0)
+
+        o = m.binary_to_T_mult__double(a1, a2, where=w)
+        self.assertTrue((o[w] == (a1*a2)[w]).all())
+        self.assertTrue((o[~w] == 0).all())
+
+        # Masked-out elements of a provided output array stay intact, also
+        # when the output array is written through the iterator buffers.
+        for dt in (np.float64, np.float32):
+            o = np.full((self.N,), -1, dtype=dt)
+            m.binary_to_T_mult__allow_threads__double(a1, a2, out=o, where=w, nthreads=3)
+            self.assertTrue((o[w] == (a1*a2)[w].astype(dt)).all())
+            self.assertTrue((o[~w] == -1).all())
+
+        o = np.full((self.N,), -1, dtype=np.float64)
+        m.binary_to_T_mult__double(a1, a2, out=o, where=False)
+        self.assertTrue((o == -1).all())
+
+        # The mask is broadcasted against the loop shape.
+        c = np.arange(0,1200, dtype=np.float64).reshape((40,30))
+        w2 = (np.arange(0,30) % 2 == 0)
+        o = np.full((40,30), -1, dtype=np.float64)
+        m.binary_to_T_mult__double(c, 2.0, out=o, where=w2)
+        self.assertTrue((o[:,w2] == 2*c[:,w2]).all())
+        self.assertTrue((o[:,~w2] == -1).all())
+
+        # Functions with output arguments.
+        t = (np.full((self.N,), -1, dtype=np.float64),
+             np.full((self.N,), -1, dtype=np.float64))
+        m.binary_to_T_sum_and_diff__double(a1, a2, out=t, where=w)
+        self.assertTrue((t[0][w] == (a1+a2)[w]).all() and (t[0][~w] == -1).all())
+        self.assertTrue((t[1][w] == (a1-a2)[w]).all() and (t[1][~w] == -1).all())
+
+        self.assertRaises(ValueError, m.binary_to_T_mult__double, a1, a2, where=np.ones((2,self.N), dtype=bool))
+
+    def test_where_index(self):
+        m = dstream_test_module
+        c = np.arange(0,1200, dtype=np.float64).reshape((40,30))
+        a2 = np.arange(0,30, dtype=np.float64)*0.5
+        idx = np.array([5, 17, 1199, -1, 300])
+        f = idx % 1200
+
+        # Flat indices.
+        o = m.binary_to_T_mult__allow_threads__double(c, a2, where=idx, nthreads=3)
+        e = np.zeros((40,30), dtype=np.float64)
+        e.flat[f] = (c*a2).flat[f]
+        self.assertTrue((o == e).all())
+
+        # A multi-index, scattered into a provided output array.
+        mi = (np.array([0, 3, 39]), np.array([1, 2, 29]))
+        o = np.full((40,30), -1, dtype=np.float32)
+        m.binary_to_T_mult__double(c, a2, out=o, where=mi)
+        e = np.full((40,30), -1, dtype=np.float32)
+        e[mi] = (c*a2)[mi]
+        self.assertTrue((o == e).all())
+
+        # Accumulating functions combine the results with the gathered
+        # values of the output array. Duplicate indices are rejected.
+        uidx = np.array([5, 17, -1, 300])
+        uf = uidx % 1200
+        o = np.ones((40,30), dtype=np.float64)
+        m.binary_to_T_mult__accumulate_add__double(c, a2, out=o, where=uidx)
+        e = np.ones((40,30), dtype=np.float64)
+        e.flat[uf] += (c*a2).flat[uf]
+        self.assertTrue((o == e).all())
+
+        self.assertRaises(ValueError, m.binary_to_T_mult__accumulate_add__double, c, a2, out=o, where=idx)
+        self.assertRaises(ValueError, m.binary_to_T_mult__accumulate_add__double, c, a2, out=o, where=(np.array([0, 0]), np.array([3, 3])))
+        self.assertTrue((o == e).all())
+
+        # An empty list selects no loop position.
+        o = np.full((40,30), -1, dtype=np.float64)
+        m.binary_to_T_mult__double(c, a2, out=o, where=[])
+        self.assertTrue((o == -1).all())
+
+        o = m.binary_to_T_mult__double(c, a2, where=[])
+        self.assertTrue((o == 0).all())
+
+        # Core dimensions.
+        v = np.arange(0,200, dtype=np.float64).reshape((50,4))
+        o = m.viewT_scale__double(v, 2.0, where=np.array([3, 49]))
+        self.assertTrue((o[[3,49]] == 2*v[[3,49]]).all())
+        self.assertTrue((o[0] == 0).all())
+
+        self.assertRaises(IndexError, m.binary_to_T_mult__double, c, a2, where=np.array([1200]))
+        self.assertRaises(ValueError, m.binary_to_T_mult__double, c, a2, where=(np.array([1]),))
+
+    def test_complex_element_types(self):
+        a1 = np.arange(0,self.N, dtype=np.float64)*(1+2j)
+        a2 = np.arange(0,self.N, dtype=np.float64)*(3-1j)
+
+        o = dstream_test_module.binary_to_T_mult__complex128(a1, a2)
+        self.assertTrue(o.dtype == np.complex128)
+        self.assertTrue((o == a1*a2).all())
+
+        o = dstream_test_module.binary_to_T_mult__allow_threads__complex128(a1, a2, nthreads=3)
+        self.assertTrue((o == a1*a2).all())
+
+        o = np.empty((self.N,), dtype=np.complex128)
+        dstream_test_module.binary_to_T_mult__complex128(a1, a2, out=o)
+        self.assertTrue((o == a1*a2).all())
+
+        b = np.arange(0,self.N, dtype=np.float64) % 1000
+        b1 = (b*(1+2j)).astype(np.complex64)
+        b2 = (b*(3-1j)).astype(np.complex64)
+        o = dstream_test_module.binary_to_T_mult__complex64(b1, b2)
+        self.assertTrue(o.dtype == np.complex64)
+        self.assertTrue((o == b1*b2).all())
+
+        (s, d) = dstream_test_module.binary_to_T_sum_and_diff__complex128(a1, a2)
+        self.assertTrue((s == a1+a2).all())
+        self.assertTrue((d == a1-a2).all())
+
+        m1 = a1.reshape((self.N//4,4))
+        m2 = a2.reshape((self.N//4,4))
+        r = m1[:,0]*m2[:,0] + m1[:,1]*m2[:,1] + m1[:,2]*m2[:,2] + m1[:,3]*m2[:,3]
+        o = dstream_test_module.vectorT_dot__complex128(m1, m2)
+        self.assertTrue((o == r).all())
+
+        o = dstream_test_module.viewT_dot__complex128(m1, m2)
+        self.assertTrue((o == r).all())
+
+    def test_float16_element_type(self):
+        a1 = np.linspace(-300, 300, self.N).astype(np.float16)
+        a2 = np.linspace(-1, 1, self.N).astype(np.float16)
+
+        # Squares beyond the float16 range are narrowed to infinity.
+        o = dstream_test_module.unary_to_T_squared__float16(a1)
+        self.assertTrue(o.dtype == np.float16)
+        with np.errstate(over='ignore'):
+            self.assertTrue((o == a1*a1).all())
+        self.assertTrue(np.isinf(o).any())
+
+        o = dstream_test_module.binary_to_T_mult__float16(a1, a2)
+        self.assertTrue(o.dtype == np.float16)
+        self.assertTrue((o == a1*a2).all())
+
+        o = dstream_test_module.binary_to_T_mult__allow_threads__float16(a1, a2, nthreads=3)
+        self.assertTrue((o == a1*a2).all())
+
+        o = np.empty((self.N,), dtype=np.float16)
+        dstream_test_module.binary_to_T_mult__float16(a1, a2, out=o)
+        self.assertTrue((o == a1*a2).all())
+
+        m1 = (np.arange(0,self.N) % 8).astype(np.float16).reshape((self.N//4,4))
+        m2 = m1[:,::-1]
+        r = (m1.astype(np.float64)*m2).sum(axis=1)
+        o = dstream_test_module.vectorT_cref_dot__float16(m1, m2)
+        self.assertTrue(o.dtype == np.float16)
+        self.assertTrue((o == r).all())
+
+        o = dstream_test_module.viewT_dot__float16(m1, m2)
+        self.assertTrue((o == r).all())
+
+    def test_dequantized_arguments(self):
+        q = (np.arange(0,self.N) % 256 - 128).astype(np.int8)
+
+        r = (np.float32(0.5)*(q.astype(np.float32) - np.float32(-3)))**2
+        o = dstream_test_module.unary_to_T_squared__dequantize_int8__float(q, 0.5, -3)
+        self.assertTrue(o.dtype == np.float32)
+        self.assertTrue((o == r).all())
+
+        u = (np.arange(0,self.N) % 256).astype(np.uint8)
+        a = np.arange(0,self.N, dtype=np.float64)
+        r = 0.25*(u.astype(np.float64) - 128)*a
+        o = dstream_test_module.binary_to_T_mult__dequantize_uint8__double(u, 0.25, 128, a, nthreads=3)
+        self.assertTrue((o == r).all())
+
+    def test_column_arguments(self):
+        m = dstream_test_module
+        t = np.arange(0,3*self.N, dtype=np.float64).reshape((self.N,3))
+        r = t[:,0] + 2*t[:,1] + 3*t[:,2]
+        o = m.ternary_to_T_weighted_sum__columns__double(t, nthreads=3)
+        self.assertTrue((o == r).all())
+
+        # The fields of a record array are bound to the arguments in their
+        # order.
+        rec = np.zeros((self.N,), dtype=[('x','f8'),('y','f8'),('z','f8')])
+        rec['x'] = t[:,0]
+        rec['y'] = t[:,1]
+        rec['z'] = t[:,2]
+        o = m.ternary_to_T_weighted_sum__columns__double(rec)
+        self.assertTrue((o == r).all())
+
+        o = m.ternary_to_T_weighted_sum__columns__double(rec, where=np.array([0, 7, self.N-1]))
+        self.assertTrue((o[[0, 7, self.N-1]] == r[[0, 7, self.N-1]]).all())
+
+        self.assertRaises(ValueError, m.ternary_to_T_weighted_sum__columns__double, t[:,:2])
+
+    def test_record_arguments(self):
+        m = dstream_test_module
+        p = np.zeros((self.N,), dtype=np.dtype([('x','f8'),('y','f8'),('id','i4')], align=True))
+        p['x'] = np.arange(0,self.N, dtype=np.float64)
+        p['y'] = np.arange(0,self.N, dtype=np.float64)*0.5
+        p['id'] = np.arange(0,self.N) % 1000
+
+        o = m.particle_shifted(p, 2.0, nthreads=3)
+        self.assertTrue(o.dtype == p.dtype)
+        self.assertTrue((o['x'] == p['x'] + 2).all())
+        self.assertTrue((o['y'] == p['y'] - 2).all())
+        self.assertTrue((o['id'] == p['id']).all())
+
+        o = m.particle_norm2(p)
+        self.assertTrue((o == p['x']**2 + p['y']**2).all())
+
+        # Record arrays with another memory layout, e.g. packed ones, are
+        # converted.
+        q = np.zeros((self.N,), dtype=[('x','f8'),('y','f8'),('id','i4')])
+        q['x'] = p['x']
+        q['y'] = p['y']
+        o = m.particle_norm2(q)
+        self.assertTrue((o == p['x']**2 + p['y']**2).all())
+
+    def test_buffered_casting(self):
+        a = np.arange(0,self.N) % 1000
+        r = (a*a).astype(np.float64)
+
+        o = dstream_test_module.binary_to_T_mult__buffered__double(a.astype(np.float32), a.astype(np.int32))
+        self.assertTrue(o.dtype == np.float64)
+        self.assertTrue((o == r).all())
+
+        # Byte-swapped and non-contiguous input arrays.
+        b = a.astype('>f8')
+        c = np.repeat(a.astype(np.float32), 2)[::2]
+        o = dstream_test_module.binary_to_T_mult__buffered__double(b, c)
+        self.assertTrue((o == r).all())
+
+        o = dstream_test_module.binary_to_T_mult__buffered_allow_threads__double(b, c, nthreads=3)
+        self.assertTrue((o == r).all())
+
+        o = dstream_test_module.binary_to_T_mult__buffered_allow_threads__double(a.astype(np.int16), 2, nthreads=3)
+        self.assertTrue((o == 2*a).all())
+
+    def test_accumulate(self):
+        m = dstream_test_module
+        a1 = np.arange(0,self.N, dtype=np.float64)
+        a2 = np.arange(0,self.N, dtype=np.float64)*0.5
+
+        o = np.ones((self.N,), dtype=np.float64)
+        m.binary_to_T_mult__accumulate_add__double(a1, a2, out=o)
+        m.binary_to_T_mult__accumulate_add__double(a1, 2.0, out=o)
+        self.assertTrue((o == 1 + a1*a2 + 2*a1).all())
+
+        # The output array is cast chunk-wise.
+        f = np.ones((self.N,), dtype=np.float32)
+        m.binary_to_T_mult__accumulate_add__double(a1, 0.5, out=f)
+        self.assertTrue((f == (1 + 0.5*a1).astype(np.float32)).all())
+
+        o = np.full((self.N,), 100, dtype=np.float64)
+        m.binary_to_T_mult__accumulate_max__allow_threads__double(a1, 2.0, out=o, nthreads=3)
+        self.assertTrue((o == np.maximum(100, 2*a1)).all())
+
+        m.binary_to_T_mult__accumulate_min__double(a1, 1.0, out=o)
+        self.assertTrue((o == np.minimum(np.maximum(100, 2*a1), a1)).all())
+
+        self.assertRaises(ValueError, m.binary_to_T_mult__accumulate_add__double, a1, a2)
+
+    def test_copy_monitor(self):
+        m = dstream_test_module
+        a = np.arange(0,self.N, dtype=np.float64)
+        f = a.astype(np.float32)
+
+        m.reset_copy_monitor()
+        m.binary_to_T_mult__double(a, a)
+        m.binary_to_T_mult__double(a, 2.0)
+        self.assertTrue(m.get_n_copies() == 0)
+
+        m.binary_to_T_mult__double(a, f)
+        self.assertTrue(m.get_n_copies() == 1)
+        self.assertTrue(m.get_n_copied_bytes() == self.N*8)
+
+        # A misaligned view of float64 values.
+        buf = np.zeros((self.N*8+1,), dtype=np.uint8)
+        u = np.frombuffer(buf.data, dtype=np.float64, count=self.N, offset=1)
+        self.assertFalse(u.flags.aligned)
+        m.binary_to_T_mult__double(u, a)
+        self.assertTrue(m.get_n_copies() == 2)
+
+        try:
+            m.set_copy_mode(m.copy_mode.never)
+            self.assertRaises(RuntimeError, m.binary_to_T_mult__double, a, f)
+            self.assertTrue(m.get_n_copies() == 2)
+            # Buffered casting needs no copy.
+            o = m.binary_to_T_mult__buffered__double(a, f)
+            self.assertTrue((o == a*f).all())
+
+            m.set_copy_mode(m.copy_mode.warn)
+            with warnings.catch_warnings(record=True) as w:
+                warnings.simplefilter('always')
+                m.binary_to_T_mult__double(f, a)
+                self.assertTrue(len(w) == 1)
+                self.assertTrue(issubclass(w[0].category, RuntimeWarning))
+            self.assertTrue(m.get_n_copies() == 3)
+        finally:
+            m.set_copy_mode(m.copy_mode.allowed)
+
+    def test_overloads(self):
+        a = np.arange(0,self.N) % 1000
+
+        o = dstream_test_module.binary_to_T_mult__overloads(a.astype(np.float32), a.astype(np.float32))
+        self.assertTrue(o.dtype == np.float32)
+        self.assertTrue((o == a*a).all())
+
+        o = dstream_test_module.binary_to_T_mult__overloads(a.astype(np.float64), a.astype(np.float32))
+        self.assertTrue(o.dtype == np.float64)
+        self.assertTrue((o == a*a).all())
+
+        o = dstream_test_module.binary_to_T_mult__overloads(v1=a.astype(np.int32), v2=np.int32(3))
+        self.assertTrue(o.dtype == np.int32)
+        self.assertTrue((o == 3*a).all())
+
+        # There is no int16 overload, but int16 can be cast safely to float32.
+        o = dstream_test_module.binary_to_T_mult__overloads(a.astype(np.int16), 2)
+        self.assertTrue(o.dtype == np.float32)
+        self.assertTrue((o == 2*a).all())
+
+        o = dstream_test_module.binary_to_T_mult__allow_threads__overloads(a.astype(np.int32), a.astype(np.int32), nthreads=3)
+        self.assertTrue(o.dtype == np.int32)
+        self.assertTrue((o == a*a).all())
+
+    def test_packed_bool_arguments(self):
+        b1 = (np.arange(0,self.N*16) % 3 == 0).reshape((self.N,16))
+        b2 = (np.arange(0,self.N*16) % 5 != 0).reshape((self.N,16))
+        m1 = np.packbits(b1, axis=1)
+        m2 = np.packbits(b2, axis=1)
+        self.assertTrue(m1.shape == (self.N,2))
+
+        o = dstream_test_module.packed_count(m1)
+        self.assertTrue((o == b1.sum(axis=1)).all())
+
+        o = dstream_test_module.packed_and(m1, m2)
+        self.assertTrue(o.dtype == np.uint8)
+        self.assertTrue((np.unpackbits(o, axis=1) == (b1 & b2)).all())
+
+        o = dstream_test_module.packed_and__allow_threads(m1, m2, nthreads=3)
+        self.assertTrue((o == (m1 & m2)).all())
+
+        # Masks with a length, that is not a multiple of 8, are padded with
+        # zeros by numpy.packbits.
+        b = (np.arange(0,self.N*10) % 3 == 0).reshape((self.N,10))
+        v = np.arange(0,self.N*10, dtype=np.float64).reshape((self.N,10))
+        o = dstream_test_module.packed_masked_sum__double(np.packbits(b, axis=1), v)
+        self.assertTrue((o == np.where(b, v, 0).sum(axis=1)).all())
+
+    def test_constant_arguments(self):
+        a = np.arange(0,self.N, dtype=np.float64)
+
+        r = a*3.5
+
+        o = dstream_test_module.binary_to_T_mult__double(a, 3.5)
+        self.assertTrue((o == r).all())
+
+        o = dstream_test_module.binary_to_T_mult__double(3.5, a)
+        self.assertTrue((o == r).all())
+
+        o = dstream_test_module.binary_to_T_mult__allow_threads__double(a, np.float64(3.5), nthreads=3)
+        self.assertTrue((o == r).all())
+
+        o = np.empty((self.N,), dtype=np.float64)
+        dstream_test_module.binary_to_T_mult__double(a, 3.5, out=o)
+        self.assertTrue((o == r).all())
+
+        f = functools.partial(dstream_test_module.binary_to_T_mult__double, v2=3.5)
+        o = f(a)
+        self.assertTrue((o == r).all())
+
+        o = dstream_test_module.binary_to_vectorT__array__double(a, 3.5)
+        self.assertTrue((o[:,0] == a).all())
+        self.assertTrue((o[:,1] == 3.5).all())
+
+        # All arguments are constant.
+        dstream_test_module.binary_to_void__double(2., 3.)
+        o = dstream_test_module.binary_to_T_mult__double(2., 3.)
+        self.assertEqual(o, 6.)
+
+    def test_static_functions(self):
+        a1 = np.arange(0,self.N, dtype=np.float64)
+        a2 = np.arange(0,self.N, dtype=np.float64)*3.42
+
+        o = dstream_test_module.unary_to_T_squared__static__double(a1)
+        self.assertTrue((o == a1*a1).all())
+
+        r = a1*a2
+
+        o = dstream_test_module.binary_to_T_mult__static__double(a1, a2)
+        self.assertTrue((o == r).all())
+
+        o = dstream_test_module.binary_to_T_mult__static_allow_threads__double(a1, a2, nthreads=3)
+        self.assertTrue((o == r).all())
+
+        o = np.empty((self.N,), dtype=np.float64)
+        dstream_test_module.binary_to_T_mult__static__double(a1, a2, out=o)
+        self.assertTrue((o == r).all())
+
+        testclass = dstream_test_module.TestClass()
+        o = testclass.binary_to_T_mult__static__double(a1, a2)
+        self.assertTrue((o == r).all())
+
+    def test_function_objects(self):
+        a1 = np.arange(0,self.N, dtype=np.float64)
+        a2 = np.arange(0,self.N, dtype=np.float64)*3.42
+
+        o = dstream_test_module.binary_to_T_scaled_mult__functor__double(a1, a2, nthreads=3)
+        self.assertTrue((o == 2.*a1*a2).all())
+
+        if(hasattr(dstream_test_module, "binary_to_T_scaled_mult__lambda__double")):
+            o = dstream_test_module.binary_to_T_scaled_mult__lambda__double(a1, a2, nthreads=3)
+            self.assertTrue((o == 3.*a1*a2).all())
+
     def test_unary_methods(self):
         testclass = dstream_test_module.TestClass()
 
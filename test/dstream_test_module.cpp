@@ -16,10 +16,19 @@
  *        Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
  *        http://www.boost.org/LICENSE_1_0.txt).
  */
+#include <complex>
 #include <vector>
 
+#include <boost/array.hpp>
 #include <boost/python.hpp>
 #include <boost/shared_ptr.hpp>
+#include <boost/tuple/tuple.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_ARRAY) && !defined(BOOST_NO_CXX11_HDR_TUPLE)
+#include <array>
+#include <tuple>
+#define BOOST_NUMPY_TEST_STD_ARRAY_AND_TUPLE
+#endif
 
 #include <boost/numpy.hpp>
 #include <boost/numpy/dstream.hpp>
@@ -58,6 +67,23 @@ binary_to_T_mult(T v1, T v2)
     return v1*v2;
 }
 
+// Returns a longer vector for values >= 10, i.e. a ragged result.
+template <typename T>
+static
+std::vector<T>
+unary_to_vectorT_ragged(T v)
+{
+    return std::vector<T>((v < 10 ? 2 : 3), v);
+}
+
+template <typename T>
+static
+T
+ternary_to_T_weighted_sum(T v1, T v2, T v3)
+{
+    return v1 + 2*v2 + 3*v3;
+}
+
 template <typename T>
 static
 std::vector<T>
@@ -69,6 +95,263 @@ binary_to_vectorT(T v1, T v2)
     return vec;
 }
 
+template <typename T>
+static
+boost::array<T, 3>
+binary_to_arrayT(T v1, T v2)
+{
+    boost::array<T, 3> arr = {{ v1, v2, v1*v2 }};
+    return arr;
+}
+
+template <typename T>
+static
+boost::array< boost::array<T, 2>, 2 >
+binary_to_arrayT_2x2(T v1, T v2)
+{
+    boost::array< boost::array<T, 2>, 2 > arr = {{ {{ v1, v2 }}, {{ -v2, v1 }} }};
+    return arr;
+}
+
+template <typename T>
+static
+boost::tuple<T, int>
+binary_to_tupleT_int(T v1, T v2)
+{
+    return boost::make_tuple(v1*v2, int(v1 < v2));
+}
+
+#ifdef BOOST_NUMPY_TEST_STD_ARRAY_AND_TUPLE
+template <typename T>
+static
+std::array<T, 3>
+binary_to_std_arrayT(T v1, T v2)
+{
+    std::array<T, 3> arr = {{ v1, v2, v1*v2 }};
+    return arr;
+}
+
+template <typename T>
+static
+std::tuple<T, int, bool>
+binary_to_std_tupleT_int_bool(T v1, T v2)
+{
+    return std::make_tuple(v1*v2, int(v1 < v2), v1 == v2);
+}
+#endif
+
+template <typename T>
+static
+boost::array<T, 3>
+arrayT_cross(boost::array<T, 3> const & v1, boost::array<T, 3> const & v2)
+{
+    boost::array<T, 3> r = {{ v1[1]*v2[2] - v1[2]*v2[1]
+                            , v1[2]*v2[0] - v1[0]*v2[2]
+                            , v1[0]*v2[1] - v1[1]*v2[0] }};
+    return r;
+}
+
+template <typename T>
+static
+T
+arrayT_3x3_trace(boost::array< boost::array<T, 3>, 3 > const & m)
+{
+    return m[0][0] + m[1][1] + m[2][2];
+}
+
+template <typename T>
+static
+T
+vectorT_dot(std::vector<T> v1, std::vector<T> v2)
+{
+    T r = 0;
+    for(size_t i=0; i<v1.size(); ++i)
+    {
+        r += v1[i]*v2[i];
+    }
+    return r;
+}
+
+template <typename T>
+static
+T
+vectorT_cref_dot(std::vector<T> const & v1, std::vector<T> const & v2)
+{
+    T r = 0;
+    for(size_t i=0; i<v1.size(); ++i)
+    {
+        r += v1[i]*v2[i];
+    }
+    return r;
+}
+
+// Returns 1, if the storage of the outer and the inner vectors of m is the
+// same as for the previous call, and 0 otherwise.
+template <typename T>
+static
+intptr_t
+vector2dT_cref_storage_reused(std::vector< std::vector<T> > const & m)
+{
+    static void const * outer = NULL;
+    static void const * inner = NULL;
+    intptr_t const reused = (&m[0] == outer && &m.back()[0] == inner);
+    outer = &m[0];
+    inner = &m.back()[0];
+    return reused;
+}
+
+template <typename T>
+static
+T
+vector2dT_cref_sum(std::vector< std::vector<T> > const & m)
+{
+    T r = 0;
+    for(size_t i=0; i<m.size(); ++i)
+    {
+        for(size_t j=0; j<m[i].size(); ++j)
+        {
+            r += m[i][j];
+        }
+    }
+    return r;
+}
+
+template <typename T>
+static
+T
+viewT_dot(ds::array_view<T const, 1> v1, ds::array_view<T const, 1> v2)
+{
+    T r = 0;
+    for(intptr_t i=0; i<v1.size(0); ++i)
+    {
+        r += v1[i]*v2[i];
+    }
+    return r;
+}
+
+template <typename T>
+static
+T
+viewT_trace(ds::array_view<T const, 2> const & m)
+{
+    T r = 0;
+    for(intptr_t i=0; i<m.size(0) && i<m.size(1); ++i)
+    {
+        r += m(i, i);
+    }
+    return r;
+}
+
+template <typename T>
+static
+void
+binary_to_T_sum_and_diff(T v1, T v2, T & sum, T & diff)
+{
+    sum  = v1 + v2;
+    diff = v1 - v2;
+}
+
+template <typename T>
+static
+void
+viewT_scale(ds::array_view<T const, 1> v, T scale, ds::array_view<T, 1> out)
+{
+    for(intptr_t i=0; i<v.size(0); ++i)
+    {
+        out[i] = scale*v[i];
+    }
+}
+
+template <typename T>
+static
+void
+viewT_outer(ds::array_view<T const, 1> v1, ds::array_view<T const, 1> v2, ds::array_view<T, 2> out)
+{
+    for(intptr_t i=0; i<v1.size(0); ++i)
+    {
+        for(intptr_t j=0; j<v2.size(0); ++j)
+        {
+            out(i, j) = v1[i]*v2[j];
+        }
+    }
+}
+
+struct particle
+{
+    double  x;
+    double  y;
+    int32_t id;
+};
+
+static
+particle
+particle_shifted(particle const & p, double d)
+{
+    particle r = { p.x + d, p.y - d, p.id };
+    return r;
+}
+
+static
+double
+particle_norm2(particle p)
+{
+    return p.x*p.x + p.y*p.y;
+}
+
+static
+intptr_t
+packed_count(ds::array_view<ds::packed_bool const, 1> m)
+{
+    intptr_t n = 0;
+    for(intptr_t i=0; i<m.size(0); ++i)
+    {
+        n += m[i];
+    }
+    return n;
+}
+
+static
+void
+packed_and(ds::array_view<ds::packed_bool const, 1> m1, ds::array_view<ds::packed_bool const, 1> m2, ds::array_view<ds::packed_bool, 1> out)
+{
+    for(intptr_t i=0; i<m1.size(0); ++i)
+    {
+        out[i] = m1[i] && m2[i];
+    }
+}
+
+template <typename T>
+static
+T
+packed_masked_sum(ds::array_view<ds::packed_bool const, 1> m, ds::array_view<T const, 1> v)
+{
+    T r = 0;
+    for(intptr_t i=0; i<v.size(0); ++i)
+    {
+        if(m[i])
+        {
+            r += v[i];
+        }
+    }
+    return r;
+}
+
+template <typename T>
+struct binary_to_T_scaled_mult
+{
+    binary_to_T_scaled_mult(T scale)
+      : scale_(scale)
+    {}
+
+    T
+    operator()(T v1, T v2) const
+    {
+        return scale_*v1*v2;
+    }
+
+    T scale_;
+};
+
 struct TestClass
 {
     template <typename T>
@@ -136,6 +419,8 @@ struct TestClass
 
 }// namespace test
 
+BOOST_NUMPY_RECORD(test::particle, (x)(y)(id))
+
 BOOST_PYTHON_MODULE(dstream_test_module)
 {
     bn::initialize();
@@ -179,6 +464,142 @@ BOOST_PYTHON_MODULE(dstream_test_module)
         , ((ds::scalar(), ds::scalar()) >> (ds::scalar(), ds::scalar())));
     ds::def("binary_to_vectorT__array__double", &test::binary_to_vectorT<double>, (bp::args("v1"),"v2")
         , ((ds::scalar(), ds::scalar()) >> ds::array<2>()));
+    ds::def("unary_to_vectorT_ragged__array__double", &test::unary_to_vectorT_ragged<double>, bp::arg("v")
+        , (ds::scalar() >> ds::array<2>()));
+
+    // Functions returning fixed-size arrays and tuples.
+    ds::def("binary_to_arrayT__double", &test::binary_to_arrayT<double>, (bp::args("v1"),"v2"));
+    ds::def("binary_to_arrayT__allow_threads__double", &test::binary_to_arrayT<double>, (bp::args("v1"),"v2")
+        , ds::allow_threads());
+    ds::def("binary_to_arrayT__tuple__double", &test::binary_to_arrayT<double>, (bp::args("v1"),"v2")
+        , ((ds::scalar(), ds::scalar()) >> (ds::scalar(), ds::scalar(), ds::scalar())));
+    ds::def("binary_to_arrayT_2x2__double", &test::binary_to_arrayT_2x2<double>, (bp::args("v1"),"v2"));
+    ds::def("binary_to_tupleT_int__double", &test::binary_to_tupleT_int<double>, (bp::args("v1"),"v2"));
+    ds::def("binary_to_tupleT_int__allow_threads__double", &test::binary_to_tupleT_int<double>, (bp::args("v1"),"v2")
+        , ds::allow_threads());
+    ds::def("arrayT_cross__double", &test::arrayT_cross<double>, (bp::args("v1"),"v2"));
+    ds::def("arrayT_cross__allow_threads__double", &test::arrayT_cross<double>, (bp::args("v1"),"v2")
+        , ds::allow_threads());
+    ds::def("arrayT_3x3_trace__double", &test::arrayT_3x3_trace<double>, bp::arg("m"));
+#ifdef BOOST_NUMPY_TEST_STD_ARRAY_AND_TUPLE
+    ds::def("binary_to_std_arrayT__double", &test::binary_to_std_arrayT<double>, (bp::args("v1"),"v2"));
+    ds::def("binary_to_std_tupleT_int_bool__double", &test::binary_to_std_tupleT_int_bool<double>, (bp::args("v1"),"v2"));
+#endif
+
+    // Functions with core dimensions.
+    ds::def("vectorT_dot__double", &test::vectorT_dot<double>, (bp::args("v1"),"v2"));
+    ds::def("vectorT_cref_dot__double", &test::vectorT_cref_dot<double>, (bp::args("v1"),"v2"));
+    ds::def("vectorT_cref_dot__allow_threads__double", &test::vectorT_cref_dot<double>, (bp::args("v1"),"v2")
+        , ds::allow_threads());
+    ds::def("vector2dT_cref_sum__double", &test::vector2dT_cref_sum<double>, bp::arg("m"));
+    ds::def("vector2dT_cref_storage_reused__double", &test::vector2dT_cref_storage_reused<double>, bp::arg("m"));
+    ds::def("vectorT_dot__fixed3__double", &test::vectorT_dot<double>, (bp::args("v1"),"v2")
+        , ((ds::array<3>(), ds::array<3>()) >> ds::scalar()));
+    ds::def("vectorT_dot__allow_threads__double", &test::vectorT_dot<double>, (bp::args("v1"),"v2")
+        , ds::allow_threads());
+    ds::def("viewT_dot__double", &test::viewT_dot<double>, (bp::args("v1"),"v2"));
+    ds::def("viewT_dot__allow_threads__double", &test::viewT_dot<double>, (bp::args("v1"),"v2")
+        , ds::allow_threads());
+    ds::def("viewT_trace__double", &test::viewT_trace<double>, (bp::arg("m")));
+
+    // Functions with output arguments.
+    ds::def("binary_to_T_sum_and_diff__double", &test::binary_to_T_sum_and_diff<double>, (bp::args("v1"),"v2"));
+    ds::def("binary_to_T_sum_and_diff__allow_threads__double", &test::binary_to_T_sum_and_diff<double>, (bp::args("v1"),"v2")
+        , ((ds::scalar(), ds::scalar()) >> (ds::scalar(), ds::scalar()))
+        , ds::allow_threads());
+    ds::def("viewT_scale__double", &test::viewT_scale<double>, (bp::args("v"),"scale"));
+    ds::def("viewT_scale__allow_threads__double", &test::viewT_scale<double>, (bp::args("v"),"scale")
+        , ds::allow_threads());
+    ds::def("viewT_outer__double", &test::viewT_outer<double>, (bp::args("v1"),"v2")
+        , ((ds::array<ds::dim::I>(), ds::array<ds::dim::J>()) >> ds::array<ds::dim::I, ds::dim::J>()));
+
+    // Functions with complex element types.
+    ds::def("binary_to_T_mult__complex128", &test::binary_to_T_mult< std::complex<double> >, (bp::args("v1"),"v2"));
+    ds::def("binary_to_T_mult__allow_threads__complex128", &test::binary_to_T_mult< std::complex<double> >, (bp::args("v1"),"v2")
+        , ds::allow_threads());
+    ds::def("binary_to_T_mult__complex64", &test::binary_to_T_mult< std::complex<float> >, (bp::args("v1"),"v2"));
+    ds::def("vectorT_dot__complex128", &test::vectorT_dot< std::complex<double> >, (bp::args("v1"),"v2"));
+    ds::def("viewT_dot__complex128", &test::viewT_dot< std::complex<double> >, (bp::args("v1"),"v2"));
+    ds::def("binary_to_T_sum_and_diff__complex128", &test::binary_to_T_sum_and_diff< std::complex<double> >, (bp::args("v1"),"v2"));
+
+    // Functions with half precision element types.
+    ds::def("unary_to_T_squared__float16", &test::unary_to_T_squared<bn::float16>, bp::arg("v"));
+    ds::def("binary_to_T_mult__float16", &test::binary_to_T_mult<bn::float16>, (bp::args("v1"),"v2"));
+    ds::def("binary_to_T_mult__allow_threads__float16", &test::binary_to_T_mult<bn::float16>, (bp::args("v1"),"v2")
+        , ds::allow_threads());
+    ds::def("vectorT_cref_dot__float16", &test::vectorT_cref_dot<bn::float16>, (bp::args("v1"),"v2"));
+    ds::def("viewT_dot__float16", &test::viewT_dot<bn::float16>, (bp::args("v1"),"v2"));
+
+    // Functions with a dequantized first argument.
+    ds::def("unary_to_T_squared__dequantize_int8__float", ds::dequantize<int8_t>(&test::unary_to_T_squared<float>), (bp::args("q"),"scale","zero_point"));
+    ds::def("binary_to_T_mult__dequantize_uint8__double", ds::dequantize<uint8_t>(&test::binary_to_T_mult<double>), (bp::args("q"),"scale","zero_point","v2")
+        , ds::allow_threads());
+
+    // Functions taking the columns of one array as arguments.
+    ds::def("ternary_to_T_weighted_sum__columns__double", ds::columns(&test::ternary_to_T_weighted_sum<double>), bp::arg("t")
+        , ds::allow_threads());
+
+    // Functions with record arguments and return types.
+    ds::def("particle_shifted", &test::particle_shifted, (bp::args("p"),"d")
+        , ds::allow_threads());
+    ds::def("particle_norm2", &test::particle_norm2, bp::arg("p"));
+
+    // Functions with bit-packed boolean arguments.
+    ds::def("packed_count", &test::packed_count, bp::arg("m"));
+    ds::def("packed_and", &test::packed_and, (bp::args("m1"),"m2"));
+    ds::def("packed_and__allow_threads", &test::packed_and, (bp::args("m1"),"m2")
+        , ds::allow_threads());
+    ds::def("packed_masked_sum__double", &test::packed_masked_sum<double>, (bp::args("m"),"v")
+        , ((ds::array<ds::dim::I>(), ds::array<ds::dim::J>()) >> ds::scalar()));
+
+    // Functions casting their input arrays in the iterator buffers.
+    ds::def("binary_to_T_mult__buffered__double", &test::binary_to_T_mult<double>, (bp::args("v1"),"v2")
+        , ds::buffered_casting<>());
+    ds::def("binary_to_T_mult__buffered_allow_threads__double", &test::binary_to_T_mult<double>, (bp::args("v1"),"v2")
+        , ds::buffered_casting<256>(), ds::allow_threads());
+
+    // Functions accumulating their results into the output array.
+    ds::def("binary_to_T_mult__accumulate_add__double", &test::binary_to_T_mult<double>, (bp::args("v1"),"v2")
+        , ds::accumulate<ds::add>());
+    ds::def("binary_to_T_mult__accumulate_max__allow_threads__double", &test::binary_to_T_mult<double>, (bp::args("v1"),"v2")
+        , ds::accumulate<ds::maximum>(), ds::allow_threads());
+    ds::def("binary_to_T_mult__accumulate_min__double", &test::binary_to_T_mult<double>, (bp::args("v1"),"v2")
+        , ds::accumulate<ds::minimum>());
+
+    // The copy monitor of input arrays.
+    bp::enum_<ds::copy_mode_t>("copy_mode")
+        .value("allowed", ds::COPY_ALLOWED)
+        .value("warn",    ds::COPY_WARN)
+        .value("never",   ds::COPY_NEVER)
+    ;
+    bp::def("set_copy_mode", &ds::copy_monitor::set_mode);
+    bp::def("get_n_copies", &ds::copy_monitor::get_n_copies);
+    bp::def("get_n_copied_bytes", &ds::copy_monitor::get_n_bytes);
+    bp::def("reset_copy_monitor", &ds::copy_monitor::reset);
+
+    // Functions with overloads for several data types.
+    ds::def("binary_to_T_mult__overloads", ds::overloads(&test::binary_to_T_mult<float>, &test::binary_to_T_mult<double>, &test::binary_to_T_mult<int32_t>), (bp::args("v1"),"v2"));
+    ds::def("binary_to_T_mult__allow_threads__overloads", ds::overloads(&test::binary_to_T_mult<float>, &test::binary_to_T_mult<double>, &test::binary_to_T_mult<int32_t>), (bp::args("v1"),"v2")
+        , ds::allow_threads());
+
+    // Functions bound at compile time.
+    ds::def<double (*)(double, double), &test::binary_to_T_mult<double> >("binary_to_T_mult__static__double", (bp::args("v1"),"v2"));
+    ds::def<double (*)(double, double), &test::binary_to_T_mult<double> >("binary_to_T_mult__static_allow_threads__double", (bp::args("v1"),"v2")
+        , ds::allow_threads());
+#if defined(__cpp_nontype_template_parameter_auto)
+    ds::def<&test::unary_to_T_squared<double> >("unary_to_T_squared__static__double", bp::arg("v"));
+#else
+    ds::def<double (*)(double), &test::unary_to_T_squared<double> >("unary_to_T_squared__static__double", bp::arg("v"));
+#endif
+
+    // Function objects.
+    ds::def("binary_to_T_scaled_mult__functor__double", ds::functor<double (double, double)>(test::binary_to_T_scaled_mult<double>(2.)), (bp::args("v1"),"v2")
+        , ds::allow_threads());
+#if !defined(BOOST_NO_CXX11_LAMBDAS)
+    double const scale = 3.;
+    ds::def("binary_to_T_scaled_mult__lambda__double", [scale](double v1, double v2){ return scale*v1*v2; }, (bp::args("v1"),"v2")
+        , ds::allow_threads());
+#endif
 
     bp::class_<test::TestClass, boost::shared_ptr<test::TestClass> >("TestClass")
         // Unary void-return methods.
@@ -213,6 +634,9 @@ BOOST_PYTHON_MODULE(dstream_test_module)
         .def(ds::method("binary_to_vectorT__array__double", &test::TestClass::binary_to_vectorT<double>, (bp::args("v1"),"v2")
             , ((ds::scalar(), ds::scalar()) >> ds::array<2>())))
 
+        // Methods bound at compile time.
+        .def(ds::method<double (test::TestClass::*)(double, double), &test::TestClass::binary_to_T_mult<double> >("binary_to_T_mult__static__double", (bp::args("v1"),"v2")))
+
         // Note about static methods:
         //       Since the implementation of the method call of static methods
         //       is identical to the non-static methods, we need to test only
@@ -50,6 +50,8 @@ class TestDtype(unittest.TestCase):
                 self.assertEquivalent(ft(long(1)), np.dtype(t))
 
     def test_floats(self):
+        f = np.float16
+        self.assertEquivalent(dtype_test_module.accept_float16(f(np.pi)), np.dtype(f))
         f = np.float32
         c = np.complex64
         self.assertEquivalent(dtype_test_module.accept_float32(f(np.pi)), np.dtype(f))
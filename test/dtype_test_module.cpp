@@ -72,6 +72,7 @@ BOOST_PYTHON_MODULE(dtype_test_module)
     bp::def("accept_uintc",  &test::accept<unsigned int>);
 
     // floats and complex
+    bp::def("accept_float16",    &test::accept<bn::float16>);
     bp::def("accept_float32",    &test::accept<float>);
     bp::def("accept_float64",    &test::accept<double>);
     bp::def("accept_complex64",  &test::accept< std::complex<float> >);
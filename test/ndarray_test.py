@@ -80,6 +80,11 @@ class TestNdarray(unittest.TestCase):
                 v = a.transpose()
                 a1 = ndarray_test_module.transpose(a)
                 self.assertEqual(a1.shape, v.shape)
+                axes = tuple(range(1,len(shape))) + (0,)
+                v = a.transpose(axes)
+                a1 = ndarray_test_module.transpose(a, axes)
+                self.assertEqual(a1.shape, v.shape)
+                self.assertEqual(a1.strides, v.strides)
 
     def test_squeeze(self):
         a = np.array([[[3,4,5]]])
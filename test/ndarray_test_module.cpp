@@ -18,6 +18,8 @@
  *        Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
  *        http://www.boost.org/LICENSE_1_0.txt).
  */
+#include <vector>
+
 #include <boost/python.hpp>
 #include <boost/numpy.hpp>
 
@@ -41,6 +43,14 @@ static bn::ndarray empty(bp::tuple shape, bn::dtype dt)
 static bn::ndarray transpose(bn::ndarray arr)
 { return arr.transpose(); }
 
+static bn::ndarray transpose_axes(bn::ndarray arr, bp::tuple axes)
+{
+    std::vector<int> v(bp::len(axes));
+    for(size_t i=0; i<v.size(); ++i)
+        v[i] = bp::extract<int>(axes[i]);
+    return arr.transpose(v);
+}
+
 static bn::ndarray squeeze(bn::ndarray arr)
 { return arr.squeeze(); }
 
@@ -58,6 +68,7 @@ BOOST_PYTHON_MODULE(ndarray_test_module)
     bp::def("array",           &test::array2);
     bp::def("empty",           &test::empty);
     bp::def("transpose",       &test::transpose);
+    bp::def("transpose",       &test::transpose_axes);
     bp::def("squeeze",         &test::squeeze);
     bp::def("reshape",         &test::reshape);
 }